@@ -27,10 +27,14 @@
 
 /** @brief get the integer type definitions */
 #include "altoint.h"
+#include <signal.h>
 
 /** @brief type to hold nano seconds */
 typedef int64_t	ntime_t;
 
+/** @brief type to hold a timer id (generation and slot number) */
+typedef int64_t	timer_id_t;
+
 /** @brief time in nano seconds for a CPU microcycle */
 #define	CPU_MICROCYCLE_TIME	170
 
@@ -96,8 +100,8 @@ typedef int64_t	ntime_t;
 
 #if	DEBUG
 
-/** @brief non zero if simualtion shall shut down */
-extern int halted;
+/** @brief non zero if simualtion shall shut down (also set by signal handlers) */
+extern volatile sig_atomic_t halted;
 
 /** @brief non zero if simualtion shall pause */
 extern int paused;
@@ -190,8 +194,8 @@ extern int border_putch(int x, int y, uint8_t ch);
 /** @brief print a string to the surface border */
 extern int border_printf(int x, int y, const char *fmt, ...);
 
-/** @brief write 16 pixels to x, y into the alto surface */
-extern int sdl_write(int x, int y, uint32_t pixel);
+/** @brief write a span of display words of scanline y into the alto surface */
+extern int sdl_write_line(int y, int x0, int x1, const uint16_t *words);
 
 /** @brief draw a LED icon to the SDL surface border */
 extern int sdl_draw_icon(int x0, int y0, int type);
@@ -202,9 +206,12 @@ extern int sdl_chargen_alpha(const chargen_t *cg, int col, uint32_t rgb);
 /** @brief write charmap bitmap for char ch, color to x, y into the debug surface */
 extern int sdl_debug(int x, int y, int ch, int color);
 
-/** @brief update pending changes to the screen */
+/** @brief update pending changes to the screen after an emulated frame */
 extern int sdl_update(int full);
 
+/** @brief update pending changes to the screen, without counting a frame */
+extern int sdl_refresh(int full);
+
 extern void fatal(int exitcode, const char *fmt, ...);
 
 /**
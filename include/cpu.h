@@ -566,6 +566,93 @@ typedef enum {
 	p_COUNT
 }	phase_t;
 
+/** @brief flags precomputed for a decoded microinstruction */
+typedef enum {
+	/** @brief LOADT is set */
+	UC_LOADT	= (1<<0),
+	/** @brief LOADL is set */
+	UC_LOADL	= (1<<1),
+	/** @brief the BUS source is decoded (neither F1 nor F2 is const) */
+	UC_DO_BS	= (1<<2),
+	/** @brief the constant PROM is gated to the BUS */
+	UC_CONST	= (1<<3),
+	/** @brief F1 is MAR<-; check for a MAR<- stall */
+	UC_MAR_STALL	= (1<<4),
+	/** @brief F2 is MD<- (and F1 isn't MAR<-); check for a MD<- stall */
+	UC_WR_STALL	= (1<<5),
+	/** @brief BS is <-MD; check for a <-MD stall */
+	UC_RD_STALL	= (1<<6)
+}	ucode_flags_t;
+
+/** @brief shifter operations of a decoded microinstruction word */
+typedef enum {
+	sh_pass,			/**< shifter passes L */
+	sh_lsh_1,			/**< L LSH 1 */
+	sh_rsh_1,			/**< L RSH 1 */
+	sh_lcy_8,			/**< L LCY 8 */
+	sh_mlsh_1,			/**< L LSH 1 with the emulator's MAGIC */
+	sh_mrsh_1,			/**< L RSH 1 with the emulator's MAGIC */
+	sh_none,			/**< shifter is done by the emulator's F2 DNS<- */
+	sh_COUNT
+}	shifter_op_t;
+
+/** @brief value of ucode_dec_t::task if no handlers are resolved yet */
+#define	UC_TASK_NONE	0xff
+
+/**
+ * @brief a decoded microinstruction word
+ *
+ * The bit fields of ucode_raw[] are extracted once, and the BUS source,
+ * F1 and F2 handlers are resolved for the task that last executed the
+ * word, so alto_execute() does not have to do this on every cycle.
+ */
+typedef struct {
+	/** @brief the raw microinstruction word */
+	uint32_t mir;
+
+	/** @brief the BUS value after the constant PROM was gated to it */
+	uint16_t bus;
+
+	/** @brief the NEXT field */
+	uint16_t next;
+
+	/** @brief the RSEL field */
+	uint8_t rsel;
+
+	/** @brief the ALUF field */
+	uint8_t aluf;
+
+	/** @brief the BS field */
+	uint8_t bs;
+
+	/** @brief the F1 field */
+	uint8_t f1;
+
+	/** @brief the F2 field */
+	uint8_t f2;
+
+	/** @brief combination of ucode_flags_t */
+	uint8_t flags;
+
+	/** @brief task for which the handlers below are valid, or UC_TASK_NONE */
+	uint8_t task;
+
+	/** @brief the shifter operation (shifter_op_t) for that task */
+	uint8_t shift;
+
+	/** @brief the ALU/shifter kernel for ALUF, shifter operation, LOADT and LOADL */
+	uint16_t kernel;
+
+	/** @brief early and late BUS source handlers (NULL if BS is not decoded) */
+	void (*fn_bs[p_COUNT])(void);
+
+	/** @brief early and late F1 handlers */
+	void (*fn_f1[p_COUNT])(void);
+
+	/** @brief early and late F2 handlers */
+	void (*fn_f2[p_COUNT])(void);
+}	ucode_dec_t;
+
 /** @brief Structure of the CPU context */
 typedef struct {
 	/** @brief per task micro program counter */
@@ -663,15 +750,27 @@ typedef struct {
 	/** @brief set by Ether task when it want's a wakeup at switch to task_mrt */
 	int ewfct;
 
-	/** @brief display_state_machine() time time accu */
+	/** @brief display_state_machine() time accu at cycle dsp_base */
 	int dsp_time;
 
 	/** @brief display_state_machine() previous state */
 	int dsp_state;
 
-	/** @brief unload word time accu */
+	/** @brief unload word time accu at cycle unload_base (-1 if idle) */
 	int unload_time;
 
+	/** @brief cycle where dsp_time is valid */
+	ntime_t dsp_base;
+
+	/** @brief cycle where unload_time is valid */
+	ntime_t unload_base;
+
+	/** @brief next cycle to call display_state_machine() */
+	ntime_t dsp_cycle;
+
+	/** @brief next cycle with display work, i.e. min(dsp_cycle, unload cycle) */
+	ntime_t display_cycle;
+
 	/** @brief unload word number */
 	int unload_word;
 }	cpu_t;
@@ -697,6 +796,9 @@ const char *f2_name[f2_COUNT];
 /** @brief raw microcode words, decoded */
 extern uint32_t ucode_raw[UCODE_SIZE];
 
+/** @brief predecoded microcode words */
+extern ucode_dec_t ucode_dec[UCODE_SIZE];
+
 /** @brief constant PROM, decoded */
 extern uint32_t const_prom[CONST_SIZE];
 
@@ -736,15 +838,30 @@ extern cpu_t cpu;
 /** @brief number of nanoseconds left to execute in the current slice */
 extern ntime_t alto_ntime;
 
+/** @brief number of microcycles executed, i.e. ntime() / CPU_MICROCYCLE_TIME */
+extern ntime_t alto_cycle;
+
 /** @brief flag set by timer.c if alto_execute() shall leave its loop */
 extern int alto_leave;
 
+/** @brief non-zero if alto_execute() uses the threaded code engine */
+extern int alto_threaded;
+
+/** @brief decode all microcode words into ucode_dec[] */
+extern void ucode_decode_all(void);
+
 /** @brief reset the various registers */
 extern int alto_reset(void);
 
 /** @brief soft reset */
 extern int alto_soft_reset(void);
 
+/** @brief pass command line switches down to the CPU */
+extern int cpu_args(const char *arg);
+
+/** @brief print usage info for the CPU switches */
+extern int cpu_usage(int argc, char **argv);
+
 /** @brief execute microcode for a number of nanosecs */
 extern ntime_t alto_execute(ntime_t nsecs);
 
@@ -249,7 +249,7 @@ typedef struct {
 	int	bitclk;
 
 	/** @brief bit clock timer id */
-	int	bitclk_id;
+	timer_id_t bitclk_id;
 
 	/** @brief current datin drom the drive */
 	int	datin;
@@ -264,7 +264,7 @@ typedef struct {
 	int	seclate;
 
 	/** @brief sector late timer id */
-	int	seclate_id;
+	timer_id_t seclate_id;
 
 	/** @brief seekok state (SKINC' & LAI' & ff_44a.Q') */
 	int	seekok;
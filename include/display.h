@@ -323,6 +323,21 @@ typedef struct {
 	/** @brief helper: shifted cursor data (32-bit) */
 	uint32_t curdata;
 
+	/** @brief helper: next step in the display schedule (-1 if off schedule) */
+	int step;
+
+	/** @brief helper: scanline with changed words not yet written (-1 if none) */
+	int dirty_y;
+
+	/** @brief helper: first changed word in scanline dirty_y */
+	int dirty_x0;
+
+	/** @brief helper: last changed word in scanline dirty_y + 1 */
+	int dirty_x1;
+
+	/** @brief bitmaps of the changed words per scanline (cleared by the MNG recording) */
+	uint64_t dirty_words[DISPLAY_HEIGHT];
+
 	/** @brief array of words of the raw bitmap that is displayed */
 	uint16_t raw_bitmap[DISPLAY_HEIGHT][DISPLAY_VISIBLE_WORDS];
 
@@ -494,13 +509,15 @@ extern void f2_evenfield_1(void);
  * @brief create a PNG file screenshot from the current raw bitmap
  *
  * @param ptr pointer to a png_t context
+ * @param bitmap pointer to a copy of the raw bitmap, or NULL for dsp.raw_bitmap
  * @param left left clipping boundary
  * @param top top clipping boundary
  * @param right right clipping boundary (inclusive)
  * @param bottom bottom clipping boundary (inclusive)
  * @result returns 0 on success, -1 on error
  */
-extern int display_screenshot(void *ptr, int left, int top, int right, int bottom);
+extern int display_screenshot(void *ptr, const uint16_t *bitmap,
+	int left, int top, int right, int bottom);
 
 /** @brief initialize the display context */
 extern int display_init(void);
@@ -0,0 +1,85 @@
+/*****************************************************************************
+ * SALTO - Xerox Alto I/II Simulator.
+ *
+ * Copyright (C) 2007 by Juergen Buchmueller <pullmoll@t-online.de>
+ * Partially based on info found in Eric Smith's Alto simulator: Altogether
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Disk overlay (.dov) file format
+ *
+ * A disk overlay holds the sectors written to a read-only base image
+ * (.dsk, .dsk.Z or .dsk.gz). It consists of a header naming the base
+ * image, a bitmap of the pages present in the overlay, and a sparse
+ * data area where page n lives at DOV_DATA(n, sector_size). Pages that
+ * were never written are holes in the file and take no space on disk.
+ *
+ * $Id: dov.h,v 1.1.1.1 2008/07/22 19:02:07 pm Exp $
+ *****************************************************************************/
+#if !defined(_DOV_H_INCLUDED_)
+#define	_DOV_H_INCLUDED_
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/** @brief magic id at the start of an overlay file */
+#define	DOV_MAGIC	"SALTODOV"
+
+/** @brief current overlay file format version */
+#define	DOV_VERSION	1
+
+/** @brief maximum length of the base image path name, including the 0 */
+#define	DOV_BASE_MAX	1000
+
+/** @brief file offset of the page bitmap */
+#define	DOV_BITMAP	1024
+
+/** @brief maximum number of pages in an overlay */
+#define	DOV_PAGES_MAX	(8 * (DOV_DATA_START - DOV_BITMAP))
+
+/** @brief file offset of the first page's sector */
+#define	DOV_DATA_START	4096
+
+/** @brief file offset of a page's sector */
+#define	DOV_DATA(page,size) (DOV_DATA_START + (off_t)(page) * (size))
+
+/** @brief test if a page is present in an overlay bitmap */
+#define	DOV_TEST(bitmap,page) (((bitmap)[(page) >> 3] >> ((page) & 7)) & 1)
+
+/** @brief mark a page present in an overlay bitmap */
+#define	DOV_MARK(bitmap,page) (bitmap)[(page) >> 3] |= 1 << ((page) & 7)
+
+/** @brief overlay file header */
+typedef struct {
+	/** @brief magic id DOV_MAGIC (not 0 terminated) */
+	char magic[8];
+
+	/** @brief file format version DOV_VERSION */
+	uint32_t version;
+
+	/** @brief number of pages in the base image */
+	uint32_t pages;
+
+	/** @brief size of a sector (page number, header, label, data) in bytes */
+	uint32_t sector_size;
+
+	/** @brief reserved; always 0 */
+	uint32_t reserved;
+
+	/** @brief absolute path name of the base image */
+	char base[DOV_BASE_MAX];
+}	dov_header_t;
+
+#endif	/* !defined(_DOV_H_INCLUDED_) */
@@ -337,6 +337,14 @@ extern int debug_read_sec(int unit, int page, int offs);
  */
 extern void *drive_sector_callback(void (*callback)(int));
 
+/**
+ * @brief write the pages changed since the last flush back to the image
+ *
+ * @param unit unit number
+ * @result returns the number of pages written
+ */
+extern int drive_flush(int unit);
+
 /**
  * @brief print usage info for the drive switches
  *
@@ -138,7 +138,7 @@ typedef struct {
 	size_t tx_count;
 
 	/** @brief transmitter timer id */
-	int tx_id;
+	timer_id_t tx_id;
 
 	/** @brief if non-zero, interval in seconds at which to broadcast the duckbreath */
 	int duckbreath;
@@ -293,6 +293,12 @@ typedef	struct mng_s {
 	/** @brief set non-zero if MHDR is yet to be written out */
 	int write_mhdr;
 
+	/** @brief framing mode written to the FRAM chunks (1 at start) */
+	int framing;
+
+	/** @brief non-zero if images are layers of the frame from mng_start_frame() */
+	int layered;
+
 }	mng_t;
 
 /**
@@ -372,6 +378,26 @@ extern int mng_set_palette(mng_t *mng, int idx, int color);
  */
 extern png_t *mng_append_png(mng_t *mng, int x, int y, int w, int h, int color, int depth);
 
+/**
+ * @brief start a frame of one or more images in the MNG stream
+ *
+ * @param mng pointer to a mng_t context
+ * @param delay number of ticks to show the frame
+ * @result returns 0 on success, -1 on error
+ */
+extern int mng_start_frame(mng_t *mng, int delay);
+
+/**
+ * @brief write a PNG image created with png_create() to the MNG stream
+ *
+ * @param mng pointer to a mng_t context
+ * @param png pointer to a png_t context; it is finished and freed
+ * @param x x location of the PNG in the frame
+ * @param y y location of the PNG in the frame
+ * @result returns 0 on success, -1 on error
+ */
+extern int mng_append_image(mng_t *mng, png_t *png, int x, int y);
+
 /* ======================================================================== *
  *
  * The following functions are public, even though the average application
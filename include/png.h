@@ -40,6 +40,9 @@
 #endif
 
 
+/** @brief size of the IDAT chunks written (except for the last one) */
+#define	PNG_IDAT_SIZE	32768
+
 #define	COLOR_GRAYSCALE	0
 #define	COLOR_RGBTRIPLE	2
 #define	COLOR_PALETTE	3
@@ -139,6 +142,9 @@ typedef	struct png_s {
 	/** @brief offset into the uncompressed image data while reading */
 	size_t offs;
 
+	/** @brief zlib compression level (0 to 9) used when writing */
+	int level;
+
 	/** @brief image bitmap size in bytes */
 	size_t size;
 
@@ -376,6 +382,15 @@ extern int png_set_palette(png_t *png, int idx, int color);
  */
 extern int png_finish(png_t *png);
 
+/**
+ * @brief compress the image data of a PNG image
+ *
+ * @param png pointer to a png_t context
+ * @param level zlib compression level (0 to 9)
+ * @result returns 0 on success, -1 on error
+ */
+extern int png_compress(png_t *png, int level);
+
 /**
  * @brief finish a PNG image to be written to a MNG stream
  *
@@ -416,6 +431,32 @@ extern int png_put_pixel(png_t *png, int x, int y, int color, int alpha);
  */
 extern int png_get_pixel(png_t *png, int x, int y, int *color, int *alpha);
 
+/**
+ * @brief put a row of pixels into a png_t context
+ *
+ * @param png pointer to a png_t context
+ * @param x x coordinate of the first pixel
+ * @param y y coordinate of the row (0 .. png->h - 1)
+ * @param w number of pixels
+ * @param color array of w color values (format depends on PNG color format; -1 is background color)
+ * @param alpha array of w alpha values (only used in color formats with alpha channel), or NULL
+ * @result returns 0 on success, -1 on error
+ */
+extern int png_put_row(png_t *png, int x, int y, int w, const int *color, const int *alpha);
+
+/**
+ * @brief get a row of pixels from a png_t context
+ *
+ * @param png pointer to a png_t context
+ * @param x x coordinate of the first pixel
+ * @param y y coordinate of the row (0 .. png->h - 1)
+ * @param w number of pixels
+ * @param color array for w color values to return (-1 is background color)
+ * @param alpha array for w alpha values to return, or NULL
+ * @result returns 0 on success, -1 on error
+ */
+extern int png_get_row(png_t *png, int x, int y, int w, int *color, int *alpha);
+
 /**
  * @brief bit block transfer from 1bpp source
  *
@@ -40,6 +40,9 @@
 /** @brief total nano seconds simulation time */
 extern ntime_t global_ntime;
 
+/** @brief cycle number before which the next synchronous timer fires */
+extern ntime_t timer_sync_cycle;
+
 /**
  * @brief return the current time - implemented as macro for speed.
  *
@@ -52,27 +55,34 @@ extern ntime_t global_ntime;
 /**
  * @brief return the current cycle number - implemented as macro for speed.
  *
- * Take ntime and subtract the nano seconds that the current CPU slice still has to run,
- * divide by number of nano seconds per cycle.
+ * The CPU loop counts the microcycles in alto_cycle, which is always
+ * ntime() divided by the number of nano seconds per cycle, also while
+ * timer_fire() leaps forward in time.
  *
  * @result cycle number
  */
-#define	cycle() ((global_ntime - alto_ntime) / CPU_MICROCYCLE_TIME)
+#define	cycle() (alto_cycle)
 
 /** @brief return the time of the next timer event, or -1 if none */
 extern ntime_t timer_next_time(void);
 
 /** @brief peek at then n'th timer, return its name and set *atime */
-extern const char *timer_peek(int n, int *id, int *arg, ntime_t *atime);
+extern const char *timer_peek(int n, timer_id_t *id, int *arg, ntime_t *atime);
 
 /** @brief remove timer with identifier 'id' */
-extern int timer_remove(int id);
+extern int timer_remove(timer_id_t id);
 
 /** @brief insert a timer to fire at 'time', calling 'callback' with 'id' and 'arg' */
-extern int timer_insert(ntime_t time, void (*callback)(int,int), int arg, const char *name);
+extern timer_id_t timer_insert(ntime_t time, void (*callback)(timer_id_t,int), int arg, const char *name);
+
+/** @brief insert a timer to fire at 'time' synchronous to the CPU, calling 'callback' with 'id' and 'arg' */
+extern timer_id_t timer_insert_sync(ntime_t time, void (*callback)(timer_id_t,int), int arg, const char *name);
+
+/** @brief reschedule the pending or firing timer 'id' to fire at 'time', calling its callback with 'arg' */
+extern timer_id_t timer_reschedule(timer_id_t id, ntime_t time, int arg);
 
 /** @brief fire next timer, if it is due; return -1 if none, id otherwise */
-extern int timer_fire(void);
+extern timer_id_t timer_fire(void);
 
 /** @brief initialize timer functions */
 extern void timer_init(void);
@@ -25,6 +25,9 @@
 #if !defined(_ZCAT_H_INCLUDED_)
 #define	_ZCAT_H_INCLUDED_
 
+/** @brief opaque type of a compress()d or gzip stream */
+typedef struct zstream_s zstream_t;
+
 /**
  * @brief copy a block of memory and uncompress it (LZW) on the fly
  *
@@ -57,4 +60,38 @@ off_t gz_copy(uint8_t *op, size_t osize, uint8_t *ip, size_t isize);
  */
 extern int z_header(uint8_t *ip, size_t size, size_t *pskip);
 
+/**
+ * @brief open a compress()d or gzip stream from a block of memory
+ *
+ * @param ip pointer to input buffer (must stay valid until z_close())
+ * @param isize number of bytes in input buffer
+ * @result returns a pointer to the stream, or NULL on error
+ */
+extern zstream_t *z_open(uint8_t *ip, size_t isize);
+
+/**
+ * @brief uncompress the next part of a stream
+ *
+ * @param z pointer to the stream
+ * @param op pointer to output buffer
+ * @param osize number of bytes to uncompress at most
+ * @result returns the number of bytes, 0 at the end of the stream, or -1 on error
+ */
+extern off_t z_read(zstream_t *z, uint8_t *op, size_t osize);
+
+/**
+ * @brief return the uncompressed size of a stream, if its format records it
+ *
+ * @param z pointer to the stream
+ * @result returns the size in bytes, or -1 if it is not known
+ */
+extern off_t z_size(zstream_t *z);
+
+/**
+ * @brief close a stream opened with z_open()
+ *
+ * @param z pointer to the stream
+ */
+extern void z_close(zstream_t *z);
+
 #endif	/* !defined(_ZCAT_H_INCLUDED_) */
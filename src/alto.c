@@ -914,6 +914,7 @@ int alto_init(const char *rompath)
 		return -1;
 	if (load_proms(rompath))
 		return -1;
+	ucode_decode_all();
 	return 0;
 }
 
@@ -60,6 +60,15 @@
 #define	USE_ALU_74181		1
 #endif
 
+#ifndef	USE_THREADED_CODE
+#if	defined(__GNUC__)
+/** @brief build the threaded code engine (requires GCC's labels as values) */
+#define	USE_THREADED_CODE	1
+#else
+#define	USE_THREADED_CODE	0
+#endif
+#endif
+
 #ifndef	USE_PRIO_F9318
 /** @brief use task priority decoder with F9318s and 2KCTL u38 PROM (broken) */
 #define	USE_PRIO_F9318		0
@@ -89,16 +98,16 @@
 /** @brief get the word address bit field from a control RAM address */
 #define	GET_CRAM_WORDADDR(addr)	ALTO_GET(addr,16,6,15)
 
-/** @brief call a BUS SOURCE, F1, or F2 function */
-#define	CALL_FN(type,val,p) do { \
-	if (NULL != fn_##type[p][cpu.task][val]) \
-		fn_##type[p][cpu.task][val](); \
-}	while (0)
-
 
 /** @brief raw microcode words, decoded */
 uint32_t ucode_raw[UCODE_SIZE];
 
+/** @brief predecoded microcode words */
+ucode_dec_t ucode_dec[UCODE_SIZE];
+
+/** @brief non-zero if alto_execute() uses the threaded code engine */
+int alto_threaded = USE_THREADED_CODE;
+
 /** @brief constant PROM, decoded */
 uint32_t const_prom[256];
 
@@ -120,6 +129,9 @@ cpu_t cpu;
 /** @brief number of nanoseconds left to execute in the current slice */
 ntime_t alto_ntime;
 
+/** @brief number of microcycles executed, i.e. ntime() / CPU_MICROCYCLE_TIME */
+ntime_t alto_cycle;
+
 /** @brief flag set by timer.c if alto_execute() shall leave its loop */
 int alto_leave;
 
@@ -639,6 +651,117 @@ static void f1_load_mar_1(void)
 	load_mar(cpu.rsel, msb | cpu.alu);
 }
 
+/**
+ * @brief decode the microinstruction word at addr into ucode_dec[addr]
+ *
+ * The handlers are left unresolved; this is done by ucode_resolve()
+ * when a task executes the word.
+ *
+ * @param addr microcode address
+ */
+static void ucode_decode(int addr)
+{
+	ucode_dec_t *uc = &ucode_dec[addr];
+	uint32_t mir = ucode_raw[addr];
+	int flags = 0;
+
+	uc->mir = mir;
+	uc->rsel = ALTO_GET(mir, 32, DRSEL0, DRSEL4);
+	uc->aluf = ALTO_GET(mir, 32, DALUF0, DALUF3);
+	uc->bs = ALTO_GET(mir, 32, DBS0, DBS2);
+	uc->f1 = ALTO_GET(mir, 32, DF1_0, DF1_3);
+	uc->f2 = ALTO_GET(mir, 32, DF2_0, DF2_3);
+	uc->next = ALTO_GET(mir, 32, NEXT0, NEXT9);
+
+	if (ALTO_GET(mir, 32, LOADT, LOADT))
+		flags |= UC_LOADT;
+	if (ALTO_GET(mir, 32, LOADL, LOADL))
+		flags |= UC_LOADL;
+	/*
+	 * The bus source decoding is not performed if f1 = 7 or f2 = 7.
+	 * These functions use the BS field to provide part of the address
+	 * to the constant ROM
+	 */
+	if (uc->f1 != f1_const && uc->f2 != f2_const)
+		flags |= UC_DO_BS;
+	/* The constant memory is gated to the bus by F1 = 7, F2 = 7, or BS >= 4 */
+	if (!(flags & UC_DO_BS) || uc->bs >= 4)
+		flags |= UC_CONST;
+	if (uc->f1 == f1_load_mar)
+		flags |= UC_MAR_STALL;
+	else if (uc->f2 == f2_load_md)
+		flags |= UC_WR_STALL;
+	if ((flags & UC_DO_BS) && uc->bs == bs_read_md)
+		flags |= UC_RD_STALL;
+	uc->flags = flags;
+
+	if (flags & UC_CONST)
+		uc->bus = const_prom[8 * uc->rsel + uc->bs];
+	else
+		uc->bus = 0177777;
+
+	uc->task = UC_TASK_NONE;
+}
+
+/**
+ * @brief resolve the BUS source, F1 and F2 handlers of a decoded word for a task
+ *
+ * @param uc pointer to a decoded microinstruction word
+ * @param task task number
+ */
+static void ucode_resolve(ucode_dec_t *uc, int task)
+{
+	int p;
+
+	for (p = 0; p < p_COUNT; p++) {
+		uc->fn_bs[p] = (uc->flags & UC_DO_BS) ? fn_bs[p][task][uc->bs] : NULL;
+		uc->fn_f1[p] = fn_f1[p][task][uc->f1];
+		uc->fn_f2[p] = fn_f2[p][task][uc->f2];
+	}
+
+	switch (uc->f1) {
+	case f1_l_lsh_1:
+		uc->shift = sh_lsh_1;
+		if (task == task_emu) {
+			if (uc->f2 == f2_emu_magic)
+				uc->shift = sh_mlsh_1;
+			else if (uc->f2 == f2_emu_load_dns)
+				uc->shift = sh_none;
+		}
+		break;
+	case f1_l_rsh_1:
+		uc->shift = sh_rsh_1;
+		if (task == task_emu) {
+			if (uc->f2 == f2_emu_magic)
+				uc->shift = sh_mrsh_1;
+			else if (uc->f2 == f2_emu_load_dns)
+				uc->shift = sh_none;
+		}
+		break;
+	case f1_l_lcy_8:
+		uc->shift = sh_lcy_8;
+		break;
+	default:
+		uc->shift = sh_pass;
+	}
+	uc->kernel = (uc->aluf * sh_COUNT + uc->shift) * 4 +
+		(uc->flags & (UC_LOADT | UC_LOADL));
+	uc->task = task;
+}
+
+/**
+ * @brief decode all microcode words into ucode_dec[]
+ *
+ * This has to be done after the microcode and constant PROMs were loaded.
+ */
+void ucode_decode_all(void)
+{
+	int addr;
+
+	for (addr = 0; addr < UCODE_SIZE; addr++)
+		ucode_decode(addr);
+}
+
 #if	USE_PRIO_F9318
 /** @brief F9318 input lines */
 typedef enum {
@@ -1127,32 +1250,59 @@ static void wrtram(void)
 	}
 	LOG((0,0,"\n"));
 	ucode_raw[addr] = ((cpu.m << 16) | cpu.alu) ^ UCODE_INVERTED;
+	ucode_decode(addr);
 }
 
-static __inline void cpu_display_state_machine(void)
+/**
+ * @brief run the display state machine and unload words when they are due
+ *
+ * The display runs on cycle deadlines instead of counting down time
+ * accus on every microcycle. The CPU loop compares alto_cycle with
+ * cpu.display_cycle and calls this function only when it is reached.
+ *
+ * The results are the same as subtracting the microcycle time from the
+ * accus on each cycle: dsp_time and unload_time hold the accu values
+ * before the subtraction in cycle dsp_base and unload_base, and an accu
+ * underflows in cycle base + time / CPU_MICROCYCLE_TIME.
+ */
+static void cpu_display_state_machine(void)
 {
-	/*
-	 * Subtract the microcycle time from the display time accu.
-	 * If it underflows call the display state machine and add
-	 * the time for 24 pixel clocks to the accu.
-	 * This is very close to every seventh CPU cycle.
-	 */
-	cpu.dsp_time -= CPU_MICROCYCLE_TIME;
-	if (cpu.dsp_time < 0) {
+	ntime_t unload_cycle;
+
+	/* bring the unload accu up to this cycle; display_state_machine() may set it */
+	if (cpu.unload_time >= 0)
+		cpu.unload_time -= CPU_MICROCYCLE_TIME * (int)(alto_cycle - cpu.unload_base);
+	cpu.unload_base = alto_cycle;
+
+	if (alto_cycle >= cpu.dsp_cycle) {
+		/*
+		 * The display time accu underflows: call the display state
+		 * machine and add the time for 24 pixel clocks to the accu.
+		 * This is very close to every seventh CPU cycle.
+		 */
+		cpu.dsp_time -= CPU_MICROCYCLE_TIME * (int)(alto_cycle - cpu.dsp_base + 1);
 		cpu.dsp_state = display_state_machine(cpu.dsp_state);
 		cpu.dsp_time += DISPLAY_BITTIME(24);
+		cpu.dsp_base = alto_cycle + 1;
+		cpu.dsp_cycle = cpu.dsp_base + cpu.dsp_time / CPU_MICROCYCLE_TIME;
 	}
-	if (cpu.unload_time >= 0) {
+
+	if (cpu.unload_time >= 0 && cpu.unload_time < CPU_MICROCYCLE_TIME) {
 		/*
-		 * Subtract the microcycle time from the unload time accu.
-		 * If it underflows call the unload word function which adds
-		 * the time for 16 or 32 pixel clocks to the accu, or ends
-		 * the unloading by leaving unload_time at -1.
+		 * The unload time accu underflows: call the unload word
+		 * function which adds the time for 16 or 32 pixel clocks to
+		 * the accu, or ends the unloading by leaving unload_time at -1.
 		 */
 		cpu.unload_time -= CPU_MICROCYCLE_TIME;
-		if (cpu.unload_time < 0) {
-			cpu.unload_word = unload_word(cpu.unload_word);
-		}
+		cpu.unload_word = unload_word(cpu.unload_word);
+		cpu.unload_base = alto_cycle + 1;
+	}
+
+	cpu.display_cycle = cpu.dsp_cycle;
+	if (cpu.unload_time >= 0) {
+		unload_cycle = cpu.unload_base + cpu.unload_time / CPU_MICROCYCLE_TIME;
+		if (unload_cycle < cpu.display_cycle)
+			cpu.display_cycle = unload_cycle;
 	}
 }
 
@@ -1252,139 +1402,134 @@ static __inline void cpu_display_state_machine(void)
  */
 #define	SMC(s3,s2,s1,s0,m,c) (32*(s3)+16*(s2)+8*(s1)+4*(s0)+2*(m)+(c))
 
+/** @brief F nibble of a 74181 slice with carry in 0 */
+#define	ALU_LUT_F	017
+/** @brief carry generate of a 74181 slice */
+#define	ALU_LUT_G	020
+/** @brief carry propagate of a 74181 slice */
+#define	ALU_LUT_P	040
+
+/**
+ * @brief 74181 slice lookup table
+ *
+ * Indexed by S3-S0 and M (smc / 2), the A nibble and the B nibble.
+ * Each entry has the F nibble for carry in 0, and the carry generate
+ * and propagate outputs of the slice for the 74182 lookahead.
+ */
+static uint8_t alu_74181_lut[32 * 16 * 16];
+
+/**
+ * @brief build the 74181 slice lookup table
+ *
+ * In arithmetic mode each function is the sum of two terms X and Y
+ * (with -1 being 1111); the slice generates a carry if X + Y >= 16
+ * and propagates the carry in if X + Y >= 15.
+ */
+static void alu_74181_init(void)
+{
+	int sm, a, b;
+
+	for (sm = 0; sm < 32; sm++) {
+		for (a = 0; a < 16; a++) {
+			for (b = 0; b < 16; b++) {
+				int x = 0, y = 0, f;
+				uint8_t e;
+
+				if (sm & 1) {
+					/* Mode Select 1: Logic */
+					switch (sm / 2) {
+					case  0: x = ~a;	break;
+					case  1: x = ~a | ~b;	break;
+					case  2: x = ~a & b;	break;
+					case  3: x = 0;		break;
+					case  4: x = ~(a & b);	break;
+					case  5: x = ~b;	break;
+					case  6: x = a ^ b;	break;
+					case  7: x = a & ~b;	break;
+					case  8: x = ~a | b;	break;
+					case  9: x = ~a ^ ~b;	break;
+					case 10: x = b;		break;
+					case 11: x = a & b;	break;
+					case 12: x = ~0;	break;
+					case 13: x = a | ~b;	break;
+					case 14: x = a | b;	break;
+					case 15: x = a;		break;
+					}
+					alu_74181_lut[sm * 256 + a * 16 + b] = x & ALU_LUT_F;
+					continue;
+				}
+
+				/* Mode Select 0: Arithmetic */
+				switch (sm / 2) {
+				case  0: x = a;		y = 0;		break;
+				case  1: x = a | b;	y = 0;		break;
+				case  2: x = a | ~b;	y = 0;		break;
+				case  3: x = 0;		y = ~0;		break;
+				case  4: x = a;		y = a & ~b;	break;
+				case  5: x = a | b;	y = a & ~b;	break;
+				case  6: x = a;		y = ~b;		break;
+				case  7: x = a & b;	y = ~0;		break;
+				case  8: x = a;		y = a & b;	break;
+				case  9: x = a;		y = b;		break;
+				case 10: x = a | ~b;	y = a & b;	break;
+				case 11: x = a & b;	y = ~0;		break;
+				case 12: x = a;		y = a;		break;
+				case 13: x = a | b;	y = a;		break;
+				case 14: x = a | ~b;	y = a;		break;
+				case 15: x = a;		y = ~0;		break;
+				}
+				f = (x & 15) + (y & 15);
+				e = f & ALU_LUT_F;
+				if (f >= 16)
+					e |= ALU_LUT_G;
+				if (f >= 15)
+					e |= ALU_LUT_P;
+				alu_74181_lut[sm * 256 + a * 16 + b] = e;
+			}
+		}
+	}
+}
+
+/**
+ * @brief compute the ALU function smc of cpu.bus and cpu.t
+ *
+ * Four 74181 slices are looked up in alu_74181_lut[]. In arithmetic
+ * mode, the carries into the slices are computed like the 74182
+ * carry lookahead generator does from the G and P outputs, and the
+ * carry out of the most significant slice is ALUC0.
+ *
+ * @param smc S3-S0, M and C as given by SMC()
+ * @result the 16 bit ALU result
+ */
 static __inline int alu_74181(int smc)
 {
+	register const uint8_t *lut = &alu_74181_lut[(smc >> 1) * 256];
 	register uint32_t a = cpu.bus;
 	register uint32_t b = cpu.t;
-	register uint32_t c = ~smc & 1;
-	register uint32_t s = 0;
-	register uint32_t f = 0;
+	register uint32_t e0 = lut[((a <<  4) & 0360) | ( b        & 017)];
+	register uint32_t e1 = lut[( a        & 0360) | ((b >>  4) & 017)];
+	register uint32_t e2 = lut[((a >>  4) & 0360) | ((b >>  8) & 017)];
+	register uint32_t e3 = lut[((a >>  8) & 0360) | ((b >> 12) & 017)];
+	register uint32_t c0, c4, c8, c12;
 
 	if (smc & 2) {
 		/* Mode Select 1: Logic */
-		switch (smc / 4) {
-		case  0:	/* 0000: A'       */
-			f = ~a;
-			break;
-		case  1:	/* 0001: A' | B'  */
-			f = ~a | ~b;
-			break;
-		case  2:	/* 0010: A' & B   */
-			f = ~a & b;
-			break;
-		case  3:	/* 0011: logic 0  */
-			f = 0;
-			break;
-		case  4:	/* 0100: (A & B)' */
-			f = ~(a & b);
-			break;
-		case  5:	/* 0101: B'       */
-			f = ~b;
-			break;
-		case  6:	/* 0110: A ^ B    */
-			f = a ^ b;
-			break;
-		case  7:	/* 0111: A & B'   */
-			f = a & ~b;
-			break;
-		case  8:	/* 1000: A' | B   */
-			f = ~a | b;
-			break;
-		case  9:	/* 1001: A' ^ B'  */
-			f = ~a ^ ~b;
-			break;
-		case 10:	/* 1010: B        */
-			f = b;
-			break;
-		case 11:	/* 1011: A & B    */
-			f = a & b;
-			break;
-		case 12:	/* 1100: logic 1  */
-			f = ~0;
-			break;
-		case 13:	/* 1101: A | B'   */
-			f = a | ~b;
-			break;
-		case 14:	/* 1110: A | B    */
-			f = a | b;
-			break;
-		case 15:	/* 1111: A        */
-			f = a;
-			break;
-		}
 		cpu.aluc0 = 1;
-		return f;
+		return e0 | (e1 << 4) | (e2 << 8) | (e3 << 12);
 	}
 
-	/* Mode Select 0: Arithmetic */
-	switch (smc / 4) {
-	case  0:	/* 0000: A                      */
-		s = 0;
-		f = a + c;
-		break;
-	case  1:	/* 0001: A | B                  */
-		s = 0;
-		f = (a | b) + c;
-		break;
-	case  2:	/* 0010: A | B'                 */
-		s = 0;
-		f = (a | ~b) + c;
-		break;
-	case  3:	/* 0011: -1                     */
-		s = 1;
-		f = -1 + c;
-		break;
-	case  4:	/* 0100: A + (A & B')           */
-		s = 0;
-		f = a + (a & ~b) + c;
-		break;
-	case  5:	/* 0101: (A | B) + (A & B')     */
-		s = 0;
-		f = (a | b) + (a & ~b) + c;
-		break;
-	case  6:	/* 0110: A - B - 1              */
-		s = 1;
-		f = a - b - 1 + c;
-		break;
-	case  7:	/* 0111: (A & B) - 1            */
-		s = 1;
-		f = (a & b) - 1 + c;
-		break;
-	case  8:	/* 1000: A + (A & B)            */
-		s = 0;
-		f = a + (a & b) + c;
-		break;
-	case  9:	/* 1001: A + B                  */
-		s = 0;
-		f = a + b + c;
-		break;
-	case 10:	/* 1010: (A | B') + (A & B)     */
-		s = 0;
-		f = (a | ~b) + (a & b) + c;
-		break;
-	case 11:	/* 1011: (A & B) - 1            */
-		s = 1;
-		f = (a & b) - 1 + c;
-		break;
-	case 12:	/* 1100: A + A                  */
-		s = 0;
-		f = a + a + c;
-		break;
-	case 13:	/* 1101: (A | B) + A            */
-		s = 0;
-		f = (a | b) + a + c;
-		break;
-	case 14:	/* 1110: (A | B') + A           */
-		s = 0;
-		f = (a | ~b) + a + c;
-		break;
-	case 15:	/* 1111: A - 1                  */
-		s = 1;
-		f = a - 1 + c;
-		break;
-	}
-	cpu.aluc0 = ((f >> 16) ^ s) & 1;
-	return f & 0177777;
+	/* Mode Select 0: Arithmetic; carry in is active low */
+	c0 = ~smc & 1;
+	/* 74182 carry lookahead: Cn+x = Gx | Px & Cn */
+	c4 = (e0 & ALU_LUT_G) || ((e0 & ALU_LUT_P) && c0);
+	c8 = (e1 & ALU_LUT_G) || ((e1 & ALU_LUT_P) && c4);
+	c12 = (e2 & ALU_LUT_G) || ((e2 & ALU_LUT_P) && c8);
+	cpu.aluc0 = (e3 & ALU_LUT_G) || ((e3 & ALU_LUT_P) && c12);
+
+	return	(((e0 & ALU_LUT_F) + c0) & 017) |
+		((((e1 & ALU_LUT_F) + c4) & 017) << 4) |
+		((((e2 & ALU_LUT_F) + c8) & 017) << 8) |
+		((((e3 & ALU_LUT_F) + c12) & 017) << 12);
 }
 #endif
 
@@ -1394,6 +1539,338 @@ static __inline int alu_74181(int smc)
 /** @brief flag that tells wheter operation was 0: logic (M=1) or 1: arithmetic (M=0) */
 #define	ALUM2	2
 
+#if	USE_THREADED_CODE
+
+/*
+ * The threaded code engine executes one of 16 x sh_COUNT x 4 kernels
+ * per microinstruction, one for each combination of ALUF, shifter
+ * operation, and the LOADT and LOADL bits. ucode_resolve() stores the
+ * kernel number in ucode_dec_t::kernel.
+ *
+ * TC_F_xx computes the ALU function xx into the 32 bit unsigned F,
+ * TC_C_xx its carry, TC_M_xx is the ALUM2 flag and TC_T_xx the
+ * TSELECT flag.
+ * The results are identical to those of alu_74181(), or of the
+ * shortcut functions if USE_ALU_74181 is 0.
+ */
+#define	TC_A		((uint32_t)cpu.bus)
+#define	TC_B		((uint32_t)cpu.t)
+
+/** @brief carry of an addition */
+#define	TC_ADD_C0	((f >> 16) & 1)
+/** @brief carry of a subtraction */
+#define	TC_SUB_C0	((~f >> 16) & 1)
+
+/* 00: ALU <- BUS */
+#define	TC_F_00		TC_A
+#define	TC_C_00		1
+#define	TC_M_00		0
+#define	TC_T_00		1
+/* 01: ALU <- T */
+#define	TC_F_01		TC_B
+#define	TC_C_01		1
+#define	TC_M_01		0
+#define	TC_T_01		0
+/* 02: ALU <- BUS | T */
+#define	TC_F_02		(TC_A | TC_B)
+#define	TC_C_02		1
+#define	TC_M_02		0
+#define	TC_T_02		1
+/* 03: ALU <- BUS & T */
+#define	TC_F_03		(TC_A & TC_B)
+#define	TC_C_03		1
+#define	TC_M_03		0
+#define	TC_T_03		0
+/* 04: ALU <- BUS ^ T */
+#define	TC_F_04		(TC_A ^ TC_B)
+#define	TC_C_04		1
+#define	TC_M_04		0
+#define	TC_T_04		0
+/* 05: ALU <- BUS + 1 */
+#define	TC_F_05		(TC_A + 1)
+#define	TC_C_05		TC_ADD_C0
+#define	TC_M_05		1
+#define	TC_T_05		1
+/* 06: ALU <- BUS - 1 */
+#if	USE_ALU_74181
+#define	TC_F_06		(TC_A - 1)
+#else
+#define	TC_F_06		(TC_A + 0177777)
+#endif
+#define	TC_C_06		TC_SUB_C0
+#define	TC_M_06		1
+#define	TC_T_06		1
+/* 07: ALU <- BUS + T */
+#define	TC_F_07		(TC_A + TC_B)
+#define	TC_C_07		TC_ADD_C0
+#define	TC_M_07		1
+#define	TC_T_07		0
+/* 10: ALU <- BUS - T */
+#define	TC_F_10		(TC_A - TC_B)
+#define	TC_C_10		TC_SUB_C0
+#define	TC_M_10		1
+#define	TC_T_10		0
+/* 11: ALU <- BUS - T - 1 */
+#define	TC_F_11		(TC_A - TC_B - 1)
+#define	TC_C_11		TC_SUB_C0
+#define	TC_M_11		1
+#define	TC_T_11		0
+/* 12: ALU <- BUS + T + 1 */
+#define	TC_F_12		(TC_A + TC_B + 1)
+#define	TC_C_12		TC_ADD_C0
+#define	TC_M_12		1
+#define	TC_T_12		1
+/* 13: ALU <- BUS + SKIP */
+#define	TC_F_13		(TC_A + emu.skip)
+#define	TC_C_13		TC_ADD_C0
+#define	TC_M_13		1
+#define	TC_T_13		1
+/* 14: ALU <- BUS & T, T source is ALU */
+#define	TC_F_14		(TC_A & TC_B)
+#define	TC_C_14		1
+#define	TC_M_14		0
+#define	TC_T_14		1
+/* 15: ALU <- BUS & ~T */
+#define	TC_F_15		(TC_A & ~TC_B)
+#define	TC_C_15		1
+#define	TC_M_15		0
+#define	TC_T_15		0
+/* 16: undefined; the switch in alto_execute() falls through to 17 */
+#define	TC_F_16		TC_F_17
+#define	TC_C_16		TC_C_17
+#define	TC_M_16		TC_M_17
+#define	TC_T_16		TC_T_17
+/* 17: undefined */
+#define	TC_F_17		0177777
+#if	USE_ALU_74181
+#define	TC_C_17		0
+#else
+#define	TC_C_17		1
+#endif
+#define	TC_M_17		1
+#define	TC_T_17		0
+
+#define	TC_SHIFT_sh_pass	cpu.shifter = cpu.l
+#define	TC_SHIFT_sh_lsh_1	cpu.shifter = (cpu.l << 1) & 0177777
+#define	TC_SHIFT_sh_rsh_1	cpu.shifter = cpu.l >> 1
+#define	TC_SHIFT_sh_lcy_8	cpu.shifter = ((cpu.l >> 8) | (cpu.l << 8)) & 0177777
+#define	TC_SHIFT_sh_mlsh_1	cpu.shifter = ((cpu.l << 1) | (cpu.t >> 15)) & 0177777
+#define	TC_SHIFT_sh_mrsh_1	cpu.shifter = ((cpu.l >> 1) | (cpu.t << 15)) & 0177777
+#define	TC_SHIFT_sh_none	(void)0
+
+/**
+ * @brief kernel for ALUF af, shifter operation sh, and LOADT/LOADL bits lt
+ *
+ * This is the part of a microcycle from the ALU function up to
+ * loading the L, M and T registers.
+ */
+#define	TC_KERNEL(af,sh,lt) \
+k_##af##_##sh##_##lt: \
+	f = TC_F_##af; \
+	cpu.alu = f & 0177777; \
+	cpu.aluc0 = TC_C_##af; \
+	if (cpu.wrtram_flag) \
+		wrtram(); \
+	TC_SHIFT_##sh; \
+	if (uc->fn_f1[1]) \
+		(*uc->fn_f1[1])(); \
+	if (uc->fn_f2[1]) \
+		(*uc->fn_f2[1])(); \
+	if (uc->fn_bs[1]) \
+		(*uc->fn_bs[1])(); \
+	if ((lt) & UC_LOADL) { \
+		cpu.l = cpu.alu; \
+		cpu.laluc0 = TC_M_##af ? cpu.aluc0 : 0; \
+		if (ram_related[cpu.task]) { \
+			cpu.m = cpu.alu; \
+			cpu.s[cpu.s_reg_bank[cpu.task]][0] = cpu.alu; \
+		} \
+	} \
+	if ((lt) & UC_LOADT) { \
+		cpu.cram_addr = cpu.alu; \
+		cpu.t = TC_T_##af ? cpu.alu : cpu.bus; \
+	} \
+	goto task_switch;
+
+/** @brief the kernels for ALUF af and shifter operation sh */
+#define	TC_KERNELS_LT(af,sh) \
+	TC_KERNEL(af,sh,0) TC_KERNEL(af,sh,1) \
+	TC_KERNEL(af,sh,2) TC_KERNEL(af,sh,3)
+
+/** @brief the kernels for ALUF af */
+#define	TC_KERNELS(af) \
+	TC_KERNELS_LT(af,sh_pass) TC_KERNELS_LT(af,sh_lsh_1) \
+	TC_KERNELS_LT(af,sh_rsh_1) TC_KERNELS_LT(af,sh_lcy_8) \
+	TC_KERNELS_LT(af,sh_mlsh_1) TC_KERNELS_LT(af,sh_mrsh_1) \
+	TC_KERNELS_LT(af,sh_none)
+
+/** @brief kernel label addresses for ALUF af and shifter operation sh */
+#define	TC_ADDR_LT(af,sh) \
+	&&k_##af##_##sh##_0, &&k_##af##_##sh##_1, \
+	&&k_##af##_##sh##_2, &&k_##af##_##sh##_3
+
+/** @brief kernel label addresses for ALUF af */
+#define	TC_ADDR(af) \
+	TC_ADDR_LT(af,sh_pass), TC_ADDR_LT(af,sh_lsh_1), \
+	TC_ADDR_LT(af,sh_rsh_1), TC_ADDR_LT(af,sh_lcy_8), \
+	TC_ADDR_LT(af,sh_mlsh_1), TC_ADDR_LT(af,sh_mrsh_1), \
+	TC_ADDR_LT(af,sh_none)
+
+/**
+ * @brief execute the CPU using direct threaded code
+ *
+ * This is a variant of the loop in alto_execute() for compilers
+ * supporting labels as values (GCC and clang). Each decoded
+ * microinstruction word jumps to its specialized kernel with a single
+ * indirect jump, instead of going through the ALUF and shifter switch
+ * statements and evaluating the TSELECT and ALUM2 flags every cycle.
+ * Everything else is identical to the switch based loop.
+ */
+static void alto_execute_threaded(void)
+{
+	static void * const tc_kernel[16 * sh_COUNT * 4] = {
+		TC_ADDR(00), TC_ADDR(01), TC_ADDR(02), TC_ADDR(03),
+		TC_ADDR(04), TC_ADDR(05), TC_ADDR(06), TC_ADDR(07),
+		TC_ADDR(10), TC_ADDR(11), TC_ADDR(12), TC_ADDR(13),
+		TC_ADDR(14), TC_ADDR(15), TC_ADDR(16), TC_ADDR(17)
+	};
+	const ucode_dec_t *uc;
+	uint32_t f;
+
+	for (;;) {
+		if (alto_leave || alto_ntime < CPU_MICROCYCLE_TIME)
+			break;
+
+		/* fire timers that are synchronous to the CPU */
+		if (alto_cycle >= timer_sync_cycle) {
+			timer_fire();
+			continue;
+		}
+
+		/* display state machine and word unloading */
+		if (alto_cycle >= cpu.display_cycle)
+			cpu_display_state_machine();
+
+		/* nano seconds per cycle */
+		alto_ntime -= CPU_MICROCYCLE_TIME;
+		alto_cycle++;
+		cpu.task_ntime[cpu.task] += CPU_MICROCYCLE_TIME;
+
+		/* next instruction's mpc */
+		cpu.mpc = cpu.next;
+		uc = &ucode_dec[cpu.mpc];
+		if (uc->task != cpu.task)
+			ucode_resolve(&ucode_dec[cpu.mpc], cpu.task);
+		cpu.mir	= uc->mir;
+		cpu.rsel = uc->rsel;
+		cpu.next = uc->next | cpu.next2;
+		cpu.next2 = ucode_dec[cpu.next].next |
+			(cpu.next2 & ~UCODE_PAGE_MASK);
+		LOG((0,2,"\n%s-%04o: r:%02o af:%02o bs:%02o f1:%02o f2:%02o" \
+			" t:%o l:%o next:%05o next2:%05o cycle:%lld\n",
+			task_name[cpu.task], cpu.mpc,
+			cpu.rsel, MIR_ALUF, MIR_BS, MIR_F1, MIR_F2,
+			MIR_T, MIR_L, cpu.next, cpu.next2, cycle()));
+
+		if (uc->flags & (UC_MAR_STALL | UC_WR_STALL | UC_RD_STALL)) {
+			if (((uc->flags & UC_MAR_STALL) && check_mem_load_mar_stall(cpu.rsel)) ||
+			    ((uc->flags & UC_WR_STALL) && check_mem_write_stall()) ||
+			    ((uc->flags & UC_RD_STALL) && check_mem_read_stall())) {
+				LOG((0,3, "	memory stall\n"));
+				cpu.next2 = cpu.next;
+				cpu.next = cpu.mpc;
+				continue;
+			}
+		}
+
+		cpu.bus = uc->bus;
+
+		if (cpu.rdram_flag)
+			rdram();
+
+		/* early f2 before early bs: emulator's acsource or acdest may change rsel */
+		if (uc->fn_f2[0])
+			(*uc->fn_f2[0])();
+		if (uc->fn_bs[0])
+			(*uc->fn_bs[0])();
+		if (uc->fn_f1[0])
+			(*uc->fn_f1[0])();
+
+		goto *tc_kernel[uc->kernel];
+
+		TC_KERNELS(00) TC_KERNELS(01) TC_KERNELS(02) TC_KERNELS(03)
+		TC_KERNELS(04) TC_KERNELS(05) TC_KERNELS(06) TC_KERNELS(07)
+		TC_KERNELS(10) TC_KERNELS(11) TC_KERNELS(12) TC_KERNELS(13)
+		TC_KERNELS(14) TC_KERNELS(15) TC_KERNELS(16) TC_KERNELS(17)
+
+	task_switch:
+		if (cpu.task != cpu.next2_task) {
+			/* switch now? */
+			if (cpu.task == cpu.next_task) {
+				/* one more microinstruction */
+				cpu.next_task = cpu.next2_task;
+			} else {
+				/* save this task's mpc */
+				cpu.task_mpc[cpu.task] = cpu.next;
+				cpu.task_next2[cpu.task] = cpu.next2;
+				cpu.task = cpu.next_task;
+				LOG((log_TSW,1, "task switch to %02o:%s (cycle %lld)\n",
+					cpu.task, task_name[cpu.task], cycle()));
+				/* get new task's mpc */
+				cpu.next = cpu.task_mpc[cpu.task];
+				/* get address modifier after task switch (?) */
+				cpu.next2 = cpu.task_next2[cpu.task];
+
+				if (cpu.active_callback[cpu.task]) {
+					/*
+					 * let the task know it becomes active now
+					 * and (most probably) reset the wakeup
+					 */
+					(*cpu.active_callback[cpu.task])();
+				}
+			}
+		}
+	}
+}
+#endif	/* USE_THREADED_CODE */
+
+/**
+ * @brief pass command line switches down to the CPU
+ *
+ * @param arg a pointer to a command line switch, like "-sw"
+ * @result returns 0 if arg was accepted, -1 otherwise
+ */
+int cpu_args(const char *arg)
+{
+	if (!strcmp(arg, "-sw")) {
+		alto_threaded = 0;
+		return 0;
+	}
+#if	USE_THREADED_CODE
+	if (!strcmp(arg, "-tc")) {
+		alto_threaded = 1;
+		return 0;
+	}
+#endif
+	return -1;
+}
+
+/**
+ * @brief print usage info for the CPU switches
+ *
+ * @param argc argument count
+ * @param argv argument list
+ * @result returns 0
+ */
+int cpu_usage(int argc, char **argv)
+{
+	printf("-sw		execute microcode with the switch() based engine\n");
+#if	USE_THREADED_CODE
+	printf("-tc		execute microcode with the threaded code engine (default)\n");
+#endif
+	return 0;
+}
+
 /** @brief execute the CPU for at most nsecs nano seconds */
 ntime_t alto_execute(ntime_t nsecs)
 {
@@ -1408,24 +1885,42 @@ ntime_t alto_execute(ntime_t nsecs)
 	cpu.next = cpu.task_mpc[cpu.task];
 	cpu.next2 = cpu.task_next2[cpu.task];
 
+#if	USE_THREADED_CODE
+	if (alto_threaded)
+		alto_execute_threaded();
+	else
+#endif
 	for (;;) {
-		int do_bs, flags;
+		const ucode_dec_t *uc;
+		int flags;
 
 		if (alto_leave || alto_ntime < CPU_MICROCYCLE_TIME)
 			break;
 
-		cpu_display_state_machine();
+		/* fire timers that are synchronous to the CPU */
+		if (alto_cycle >= timer_sync_cycle) {
+			timer_fire();
+			continue;
+		}
+
+		/* display state machine and word unloading */
+		if (alto_cycle >= cpu.display_cycle)
+			cpu_display_state_machine();
 
 		/* nano seconds per cycle */
 		alto_ntime -= CPU_MICROCYCLE_TIME;
+		alto_cycle++;
 		cpu.task_ntime[cpu.task] += CPU_MICROCYCLE_TIME;
 
 		/* next instruction's mpc */
 		cpu.mpc = cpu.next;
-		cpu.mir	= ucode_raw[cpu.mpc];
-		cpu.rsel = MIR_RSEL;
-		cpu.next = MIR_NEXT | cpu.next2;
-		cpu.next2 = ALTO_GET(ucode_raw[cpu.next], 32, NEXT0, NEXT9) |
+		uc = &ucode_dec[cpu.mpc];
+		if (uc->task != cpu.task)
+			ucode_resolve(&ucode_dec[cpu.mpc], cpu.task);
+		cpu.mir	= uc->mir;
+		cpu.rsel = uc->rsel;
+		cpu.next = uc->next | cpu.next2;
+		cpu.next2 = ucode_dec[cpu.next].next |
 			(cpu.next2 & ~UCODE_PAGE_MASK);
 		LOG((0,2,"\n%s-%04o: r:%02o af:%02o bs:%02o f1:%02o f2:%02o" \
 			" t:%o l:%o next:%05o next2:%05o cycle:%lld\n",
@@ -1433,21 +1928,14 @@ ntime_t alto_execute(ntime_t nsecs)
 			cpu.rsel, MIR_ALUF, MIR_BS, MIR_F1, MIR_F2,
 			MIR_T, MIR_L, cpu.next, cpu.next2, cycle()));
 
-		/*
-		 * This bus source decoding is not performed if f1 = 7 or f2 = 7.
-		 * These functions use the BS field to provide part of the address
-		 * to the constant ROM
-		 */
-		do_bs = !(MIR_F1 == f1_const || MIR_F2 == f2_const);
-
-		if (MIR_F1 == f1_load_mar) {
+		if (uc->flags & UC_MAR_STALL) {
 			if (check_mem_load_mar_stall(cpu.rsel)) {
 				LOG((0,3, "	MAR<- stall\n"));
 				cpu.next2 = cpu.next;
 				cpu.next = cpu.mpc;
 				continue;
 			}
-		} else if (MIR_F2 == f2_load_md) {
+		} else if (uc->flags & UC_WR_STALL) {
 			if (check_mem_write_stall()) {
 				LOG((0,3, "	MD<- stall\n"));
 				cpu.next2 = cpu.next;
@@ -1455,7 +1943,7 @@ ntime_t alto_execute(ntime_t nsecs)
 				continue;
 			}
 		}
-		if (do_bs && MIR_BS == bs_read_md) {
+		if (uc->flags & UC_RD_STALL) {
 			if (check_mem_read_stall()) {
 				LOG((0,3, "	<-MD stall\n"));
 				cpu.next2 = cpu.next;
@@ -1464,39 +1952,40 @@ ntime_t alto_execute(ntime_t nsecs)
 			}
 		}
 
-		cpu.bus = 0177777;
+		/*
+		 * The constant memory is gated to the bus by F1 = 7, F2 = 7, or BS >= 4.
+		 * The decoded word has the constant (or 0177777) in its bus value.
+		 */
+		cpu.bus = uc->bus;
+#if	DEBUG
+		if (uc->flags & UC_CONST)
+			LOG((0,2,"	%#o; BUS &= CONST[%03o]\n", uc->bus, 8 * uc->rsel + uc->bs));
+#endif
 
 		if (cpu.rdram_flag)
 			rdram();
 
-		/*
-		 * The constant memory is gated to the bus by F1 = 7, F2 = 7, or BS >= 4
-		 */
-		if (!do_bs || MIR_BS >= 4) {
-			int addr = 8 * cpu.rsel + MIR_BS;
-			LOG((0,2,"	%#o; BUS &= CONST[%03o]\n", const_prom[addr], addr));
-			cpu.bus &= const_prom[addr];
-		}
-
 		/*
 		 * early f2 has to be done before early bs, because the
 		 * emulator f2 acsource or acdest may change rsel
 		 */
-		CALL_FN(f2, MIR_F2, 0);
+		if (uc->fn_f2[0])
+			(*uc->fn_f2[0])();
 
 		/*
 		 * early bs can be done now
 		 */
-		if (do_bs)
-			CALL_FN(bs, MIR_BS, 0);
+		if (uc->fn_bs[0])
+			(*uc->fn_bs[0])();
 
 		/*
 		 * early f1
 		 */
-		CALL_FN(f1, MIR_F1, 0);
+		if (uc->fn_f1[0])
+			(*uc->fn_f1[0])();
 
 		/* compute the ALU function */
-		switch (MIR_ALUF) {
+		switch (uc->aluf) {
 		/**
 		 * 00: ALU <- BUS
 		 * PROM data for S3-0:1111 M:1 C:0
@@ -1860,7 +2349,7 @@ ntime_t alto_execute(ntime_t nsecs)
 		if (cpu.wrtram_flag)
 			wrtram();
 
-		switch (MIR_F1) {
+		switch (uc->f1) {
 		case f1_l_lsh_1:
 			if (cpu.task == task_emu) {
 				if (MIR_F2 == f2_emu_magic) {
@@ -1908,20 +2397,22 @@ ntime_t alto_execute(ntime_t nsecs)
 		}
 
 		/* late F1 is done now, if any */
-		CALL_FN(f1, MIR_F1, 1);
+		if (uc->fn_f1[1])
+			(*uc->fn_f1[1])();
 
 		/* late F2 is done now, if any */
-		CALL_FN(f2, MIR_F2, 1);
+		if (uc->fn_f2[1])
+			(*uc->fn_f2[1])();
 
 		/* late BS is done now, if no constant was put on the bus */
-		if (do_bs)
-			CALL_FN(bs, MIR_BS, 1);
+		if (uc->fn_bs[1])
+			(*uc->fn_bs[1])();
 
 		/*
 		 * update L register and LALUC0, and also M register,
 		 * if a RAM related task is active
 		 */
-		if (MIR_L) {
+		if (uc->flags & UC_LOADL) {
 			/* load L from ALU */
 			cpu.l = cpu.alu;
 			if (flags & ALUM2) {
@@ -1944,7 +2435,7 @@ ntime_t alto_execute(ntime_t nsecs)
 		}
 
 		/* update T register, if LOADT is set */
-		if (MIR_T) {
+		if (uc->flags & UC_LOADT) {
 			cpu.cram_addr = cpu.alu;
 			if (flags & TSELECT) {
 				LOG((0,2, "	T<- ALU (%#o)\n", cpu.alu));
@@ -2030,6 +2521,9 @@ int alto_soft_reset(void)
 	/* reset the display state machine values */
 	cpu.dsp_time = 0;
 	cpu.dsp_state = 020;
+	cpu.dsp_base = alto_cycle;
+	cpu.dsp_cycle = alto_cycle;
+	cpu.display_cycle = alto_cycle;
 
 	/* return next task (?) */
 	return cpu.next_task;
@@ -2041,10 +2535,17 @@ int alto_reset(void)
 {
 	int task;
 
+#if	USE_ALU_74181
+	alu_74181_init();
+#endif
+
 	memset(&cpu, 0, sizeof(cpu));
 	
 	cpu.dsp_time = 0;
 	cpu.dsp_state = 020;
+	cpu.dsp_base = alto_cycle;
+	cpu.dsp_cycle = alto_cycle;
+	cpu.display_cycle = alto_cycle;
 
 	/* all tasks start in ROM0 */
 	cpu.reset_mode = 0xffff;
@@ -2121,6 +2622,9 @@ int alto_reset(void)
 
 	install_mmio_fn(0177740, 0177757, bank_reg_r, bank_reg_w);
 
+	/* the handler tables changed: re-decode all microcode words */
+	ucode_decode_all();
+
 	/* start with task 0 */
 	cpu.task = 0;
 	CPU_SET_TASK_WAKEUP(0);
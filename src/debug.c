@@ -410,7 +410,7 @@ void dbg_flush_textmap(void)
 	}
 #if	DEBUG
 	if (dbg.visible)
-		sdl_update(1);
+		sdl_refresh(1);
 #endif
 }
 
@@ -770,6 +770,12 @@ void dbg_key(void *sym, int down)
 		dbg.memory ^= 1;
 		break;
 
+	case SDLK_w:
+		/* write back changed disk sectors now */
+		drive_flush(0);
+		drive_flush(1);
+		break;
+
 	case SDLK_o:
 		/* octal mode */
 		if (dbg.base != base_OCT) {
@@ -1725,13 +1731,14 @@ void dbg_dump_regs(void)
 	dbg.color = 0;
 	h++;
 	for (i = 0; h + i < 32 ; i++) {
-		int id, arg;
+		timer_id_t id;
+		int arg;
 		ntime_t atime;
 		const char *name = timer_peek(i, &id, &arg, &atime);
 		dbg_printf_xy(w, h + i, "%*s", DBG_TEXTMAP_W - w, "");
 		if (name)
-			dbg_printf_xy(w, h + i, "%08x %s(%d) %+lldns",
-				id, name, arg, atime - ntime());
+			dbg_printf_xy(w, h + i, "%08llx %s(%d) %+lldns",
+				(long long)id, name, arg, atime - ntime());
 	}
 
 	h = 32;
@@ -1883,7 +1890,7 @@ static void dbg_watch_write(int mar, int md)
 	dbg_printf("task %s hit write mem watchpoint #%d\n",
 		task_name[cpu.task], i+1);
 	debug_view(1);
-	paused = 1;
+	__atomic_store_n(&paused, 1, __ATOMIC_RELEASE);
 }
 
 /**
@@ -1903,7 +1910,7 @@ static void dbg_watch_read(int mar, int md)
 	dbg_printf("task %s hit read mem watchpoint #%d\n",
 		task_name[cpu.task], i+1);
 	debug_view(1);
-	paused = 1;
+	__atomic_store_n(&paused, 1, __ATOMIC_RELEASE);
 }
 
 /**
@@ -2051,12 +2058,12 @@ int dbg_usage(int argc, char **argv)
  * @param id timer id
  * @param arg update rate (every arg CPU cycles)
  */
-static void dbg_callback(int id, int arg)
+static void dbg_callback(timer_id_t id, int arg)
 {
 	if (dbg.visible)
 		dbg_dump_regs();
 
-	timer_insert(arg * CPU_MICROCYCLE_TIME, dbg_callback, arg, "dbg_dump_regs");
+	timer_reschedule(id, arg * CPU_MICROCYCLE_TIME, arg);
 }
 
 /**
@@ -210,9 +210,9 @@ static const char sysclkb1[4] = {
 /** @brief disk context */
 disk_t dsk;
 
-static void disk_seclate(int id, int arg);
-static void disk_ok_to_run(int id, int arg);
-static void disk_strobon(int id, int arg);
+static void disk_seclate(timer_id_t id, int arg);
+static void disk_ok_to_run(timer_id_t id, int arg);
+static void disk_strobon(timer_id_t id, int arg);
 
 #if	DEBUG
 /** @brief human readable names for the KADR<- modes */
@@ -564,122 +564,24 @@ static __inline jkff_t update_jkff(jkff_t s0, jkff_t s1)
 #define	SEEKOK	(dsk.seekok)
 
 /**
- * @brief disk word timing
- *
- * Implement the FIFOs and gates in the description above.
- *
- * @param bitclk the current bitclk level
- * @param datin the level of the bit read from the disk
- * @param block contains the task number of a blocking task, or 0 otherwise
+ * @brief clock the word and sector task FFs through the 4 SYSCLK stages
+ *
+ * This is the reference implementation of the FFs 53b, 53a, 43a, 45a,
+ * 45b, 22b, 22a and 21b. It is used to build kwd_sysclk_lut, and it is
+ * called directly when the FFs are not in a state covered by the table.
+ *
+ * @param d pointer to the disk context whose FFs are updated
+ * @param blk_kwd non-zero if the word task is blocking
+ * @param blk_ksec non-zero if the sector task is blocking
+ * @param wdallow the WDALLOW signal (KCOM WDINHIB')
+ * @param ready0 the READY' signal from the drive
+ * @param seqerr the SEQERR signal
  */
-static void kwd_timing(int bitclk, int datin, int block)
+static void kwd_sysclk(disk_t *d, int blk_kwd, int blk_ksec,
+	int wdallow, int ready0, int seqerr)
 {
-	static int wddone0;
-	int wddone1 = wddone0;
 	int i;
 
-	LOG((log_DSK,5,"	>>> KWD timing bitclk:%d datin:%d sect4:%d\n",
-		bitclk, datin, drive_sector_mark_0(dsk.drive)));
-
-	if (0 == dsk.seclate) {
-		/* If SECLATE is 0, WDDONE' never goes low (counter's clear has precedence). */
-		LOG((log_DSK,3,"	SECLATE:0 clears bitcount:0\n"));
-		dsk.bitcount = 0;
-		dsk.carry = 0;
-	} else if (dsk.bitclk && !bitclk) {
-		/*
-		 * If SECLATE is 1, the counter will count or load:
-		 */
-		if ((dsk.shiftin & 0x10000) && !WFFO) {
-			/*
-			 * If HIORDBIT is 1 at the falling edge of BITCLK, it sets the
-			 * JK-FF 67b, and thus takes away the LOAD' assertion from the
-			 * counter. It has been loaded with 15, so it counts to 16 on
-			 * the next rising edge and makes WDDONE' go to 0.
-			 */
-			LOG((log_DSK,3,"	HIORDBIT:1 sets WFFO:1\n"));
-			PUT_KCOM_WFFO(dsk.kcom, 1);
-			disk_show_indicators(dsk.drive);
-		}
-		/*
-		 * Falling edge of BITCLK, counting continues as it was preset
-		 * with BUS[4] (WFFO) at the last KCOM<- load, or as set by a
-		 * 1 bit being read in HIORDBIT.
-		 */
-		if (WFFO) {
-			/*
-			 * If BUS[4] (WFFO) was 1, both J and K' of the FF (74109) will
-			 * be 1 at the rising edge of LDCOM' (at the end of KCOM<-)
-			 * and Q will be 1. LOAD' is deassterted: count on clock.
-			 */
-			if (++dsk.bitcount > 15)
-				dsk.bitcount = 0;
-			dsk.carry = dsk.bitcount == 15;
-			LOG((log_DSK,3,"	WFFO:1 count bitcount:%2d\n", dsk.bitcount));
-		} else {
-			/*
-			 * If BUS[4] (WFFO) was 0, both J and K' will be 0, and Q
-			 * will be 0. LOAD' is asserted: load on clock.
-			 */
-			dsk.bitcount = 15;
-			dsk.carry = 1;
-			LOG((log_DSK,3,"	WFFO:0 load bitcount:%2d\n", dsk.bitcount));
-		}
-	} else if (!dsk.bitclk && bitclk) {
-		/* clock the shift register on the rising edge of bitclk */
-		dsk.shiftin = (dsk.shiftin << 1) | datin;
-		/* and the output shift register, too */
-		dsk.shiftout = dsk.shiftout << 1;
-	}
-
-	if (wddone0 != wddone1) {
-		LOG((log_DSK,2,"	WDDONE':%d->%d\n", wddone0, wddone1));
-	}
-
-	if (dsk.carry) {
-		/* CARRY = 1 -> WDDONE' = 0 */
-		wddone1 = 0;
-		if (wddone0 == 0) {
-			/*
-			 * Latch a new data word while WDDONE is 0
-			 * Note: The shifter outputs for bits 0 to 14 are connected
-			 * to the latches inputs 1 to 15, while input bit 0 comes
-			 * from the current datin.
-			 * Shifter output 15 is the HIORDBIT signal.
-			 */
-			dsk.datain = dsk.shiftin & 0177777;
-			/* load the output shift register */
-			dsk.shiftout = dsk.dataout;
-			LOG((log_DSK,6," 	LATCH in:%06o (0x%04x) out:%06o (0x%04x)\n",
-			dsk.datain, dsk.datain, dsk.dataout, dsk.dataout));
-		}
-	} else {
-		/* CARRY = 0 -> WDDONE' = 1 */
-		wddone1 = 1;
-	}
-
-	/* remember previous state of wddone */
-	wddone0 = wddone1;
-
-	/**
-	 * JK flip-flop 43b (word task)
-	 * <PRE>
-	 * CLK	WDDONE'
-	 * J	1
-	 * K'	1
-	 * S'	1
-	 * C'	WDTSKENA
-	 * Q	to 53a J
-	 * </PRE>
-	 */
-	DEBUG_NAME("		KWD 43b");
-	dsk.ff_43b = update_jkff(dsk.ff_43b,
-		(wddone1 ? JKFF_CLK : 0) |
-		JKFF_J |
-		JKFF_K |
-		(dsk.ok_to_run ? JKFF_S : 0) |
-		((dsk.ff_43a & JKFF_Q) ? 0 : JKFF_C));
-
 	/* count for the 4 stages of sysclka and sysclkb transitions */
 	for (i = 0; i < 4; i++) {
 
@@ -704,11 +606,11 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		KWD 53b");
-		dsk.ff_53b = update_jkff(dsk.ff_53b,
+		d->ff_53b = update_jkff(d->ff_53b,
 			sysclkb1[i] |
 			0 |
-			((block == task_kwd) ? 0 : JKFF_K) |
-			(WDALLOW ? JKFF_S : 0) |
+			(blk_kwd ? 0 : JKFF_K) |
+			(wdallow ? JKFF_S : 0) |
 			JKFF_C);
 		/**
 		 * JK flip-flop 53a (word task)
@@ -722,12 +624,12 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		KWD 53a");
-		dsk.ff_53a = update_jkff(dsk.ff_53a,
+		d->ff_53a = update_jkff(d->ff_53a,
 			sysclkb1[i] |
-			((dsk.ff_43b & JKFF_Q) ? JKFF_J : 0) |
-			((block == task_kwd) ? 0 : JKFF_K) |
+			((d->ff_43b & JKFF_Q) ? JKFF_J : 0) |
+			(blk_kwd ? 0 : JKFF_K) |
 			JKFF_S |
-			(WDALLOW ? JKFF_C : 0));
+			(wdallow ? JKFF_C : 0));
 
 		/**
 		 * JK flip-flop 43a (word task)
@@ -741,12 +643,12 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		KWD 43a");
-		dsk.ff_43a = update_jkff(dsk.ff_43a,
+		d->ff_43a = update_jkff(d->ff_43a,
 			sysclka1[i] |
-			((dsk.ff_53a & JKFF_Q) ? JKFF_J : 0) |
-			((dsk.ff_53a & JKFF_Q) ? JKFF_K : 0) |
+			((d->ff_53a & JKFF_Q) ? JKFF_J : 0) |
+			((d->ff_53a & JKFF_Q) ? JKFF_K : 0) |
 			JKFF_S |
-			(WDALLOW ? JKFF_C : 0));
+			(wdallow ? JKFF_C : 0));
 
 		/**
 		 * JK flip-flop 45a (ready latch)
@@ -760,9 +662,9 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		RDYLAT 45a");
-		dsk.ff_45a = update_jkff(dsk.ff_45a,
+		d->ff_45a = update_jkff(d->ff_45a,
 			sysclka1[i] |
-			(drive_ready_0(dsk.drive) ? JKFF_J : 0) |
+			(ready0 ? JKFF_J : 0) |
 			JKFF_K |
 			JKFF_S |
 			JKFF_C);
@@ -780,10 +682,10 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		SEQERR 45b");
-		dsk.ff_45b = update_jkff(dsk.ff_45b,
+		d->ff_45b = update_jkff(d->ff_45b,
 			sysclka1[i] |
 			JKFF_J |
-			(SEQERR ? JKFF_K : 1) |
+			(seqerr ? JKFF_K : 1) |
 			JKFF_S |
 			JKFF_C);
 
@@ -799,10 +701,10 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		KSEC 22b");
-		dsk.ff_22b = update_jkff(dsk.ff_22b,
+		d->ff_22b = update_jkff(d->ff_22b,
 			sysclkb1[i] |
-			((dsk.ff_22a & JKFF_Q) ? JKFF_J : 0) |
-			((block == task_ksec) ? 0 : JKFF_K) |
+			((d->ff_22a & JKFF_Q) ? JKFF_J : 0) |
+			(blk_ksec ? 0 : JKFF_K) |
 			JKFF_S |
 			JKFF_C);
 
@@ -818,12 +720,12 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		KSEC 22a");
-		dsk.ff_22a = update_jkff(dsk.ff_22a,
+		d->ff_22a = update_jkff(d->ff_22a,
 			sysclkb1[i] |
-			((dsk.ff_21b & JKFF_Q) ? JKFF_J : 0) |
+			((d->ff_21b & JKFF_Q) ? JKFF_J : 0) |
 			JKFF_K |
 			JKFF_S |
-			((dsk.ff_22b & JKFF_Q) ? 0 : JKFF_C));
+			((d->ff_22b & JKFF_Q) ? 0 : JKFF_C));
 
 		/**
 		 * JK flip-flop 21b (sector task)
@@ -837,14 +739,238 @@ static void kwd_timing(int bitclk, int datin, int block)
 		 * </PRE>
 		 */
 		DEBUG_NAME("		KSEC 21b");
-		dsk.ff_21b = update_jkff(dsk.ff_21b,
+		d->ff_21b = update_jkff(d->ff_21b,
 			sysclkb1[i] |
-			((dsk.ff_21a & JKFF_Q) ? JKFF_J : 0) |
+			((d->ff_21a & JKFF_Q) ? JKFF_J : 0) |
 			JKFF_K |
 			JKFF_S |
-			((dsk.ff_22b & JKFF_Q) ? 0 : JKFF_C));
+			((d->ff_22b & JKFF_Q) ? 0 : JKFF_C));
+	}
+}
+
+#if	!JKFF_FUNCTION
+/** @brief index bits for the packed FF state and inputs of kwd_sysclk_lut */
+#define	KWD_Q_53B	(1 << 0)
+#define	KWD_Q_53A	(1 << 1)
+#define	KWD_Q_43A	(1 << 2)
+#define	KWD_Q_45A	(1 << 3)
+#define	KWD_Q_45B	(1 << 4)
+#define	KWD_Q_22B	(1 << 5)
+#define	KWD_Q_22A	(1 << 6)
+#define	KWD_Q_21B	(1 << 7)
+#define	KWD_Q_43B	(1 << 8)
+#define	KWD_Q_21A	(1 << 9)
+#define	KWD_BLK_KWD	(1 << 10)
+#define	KWD_BLK_KSEC	(1 << 11)
+#define	KWD_WDALLOW	(1 << 12)
+#define	KWD_READY0	(1 << 13)
+#define	KWD_SEQERR	(1 << 14)
+#define	KWD_LUT_SIZE	(1 << 15)
+
+/** @brief pack the Q output of a FF into a state bit */
+#define	KWD_Q(ff,bit)	(((ff) & JKFF_Q) ? (bit) : 0)
+
+/**
+ * @brief next states of the FFs after all 4 SYSCLK stages
+ *
+ * Indexed by the packed Q outputs of 53b, 53a, 43a, 45a, 45b, 22b, 22a,
+ * 21b, the two FF outputs 43b and 21a that feed them, and the external
+ * inputs. The update_jkff() result depends on the previous state's CLK
+ * and Q bits only, and all FFs leave the last stage with CLK high, so
+ * the table is valid whenever all 8 FFs enter with CLK high.
+ */
+static uint8_t kwd_sysclk_lut[KWD_LUT_SIZE][8];
+
+/** @brief build the kwd_sysclk_lut table with the reference implementation */
+static void kwd_sysclk_init(void)
+{
+	static disk_t d;
+	int idx;
+
+	for (idx = 0; idx < KWD_LUT_SIZE; idx++) {
+#define	KWD_FF(bit)	(JKFF_CLK | ((idx & (bit)) ? JKFF_Q : JKFF_Q0))
+		d.ff_53b = KWD_FF(KWD_Q_53B);
+		d.ff_53a = KWD_FF(KWD_Q_53A);
+		d.ff_43a = KWD_FF(KWD_Q_43A);
+		d.ff_45a = KWD_FF(KWD_Q_45A);
+		d.ff_45b = KWD_FF(KWD_Q_45B);
+		d.ff_22b = KWD_FF(KWD_Q_22B);
+		d.ff_22a = KWD_FF(KWD_Q_22A);
+		d.ff_21b = KWD_FF(KWD_Q_21B);
+		d.ff_43b = KWD_FF(KWD_Q_43B);
+		d.ff_21a = KWD_FF(KWD_Q_21A);
+#undef	KWD_FF
+		kwd_sysclk(&d,
+			idx & KWD_BLK_KWD,
+			idx & KWD_BLK_KSEC,
+			idx & KWD_WDALLOW,
+			idx & KWD_READY0,
+			idx & KWD_SEQERR);
+		kwd_sysclk_lut[idx][0] = d.ff_53b;
+		kwd_sysclk_lut[idx][1] = d.ff_53a;
+		kwd_sysclk_lut[idx][2] = d.ff_43a;
+		kwd_sysclk_lut[idx][3] = d.ff_45a;
+		kwd_sysclk_lut[idx][4] = d.ff_45b;
+		kwd_sysclk_lut[idx][5] = d.ff_22b;
+		kwd_sysclk_lut[idx][6] = d.ff_22a;
+		kwd_sysclk_lut[idx][7] = d.ff_21b;
+	}
+}
+#endif
+
+/**
+ * @brief disk word timing
+ *
+ * Implement the FIFOs and gates in the description above.
+ *
+ * @param bitclk the current bitclk level
+ * @param datin the level of the bit read from the disk
+ * @param block contains the task number of a blocking task, or 0 otherwise
+ */
+static void kwd_timing(int bitclk, int datin, int block)
+{
+	static int wddone0;
+	int wddone1 = wddone0;
+
+	LOG((log_DSK,5,"	>>> KWD timing bitclk:%d datin:%d sect4:%d\n",
+		bitclk, datin, drive_sector_mark_0(dsk.drive)));
+
+	if (0 == dsk.seclate) {
+		/* If SECLATE is 0, WDDONE' never goes low (counter's clear has precedence). */
+		LOG((log_DSK,3,"	SECLATE:0 clears bitcount:0\n"));
+		dsk.bitcount = 0;
+		dsk.carry = 0;
+	} else if (dsk.bitclk && !bitclk) {
+		/*
+		 * If SECLATE is 1, the counter will count or load:
+		 */
+		if ((dsk.shiftin & 0x10000) && !WFFO) {
+			/*
+			 * If HIORDBIT is 1 at the falling edge of BITCLK, it sets the
+			 * JK-FF 67b, and thus takes away the LOAD' assertion from the
+			 * counter. It has been loaded with 15, so it counts to 16 on
+			 * the next rising edge and makes WDDONE' go to 0.
+			 */
+			LOG((log_DSK,3,"	HIORDBIT:1 sets WFFO:1\n"));
+			PUT_KCOM_WFFO(dsk.kcom, 1);
+			disk_show_indicators(dsk.drive);
+		}
+		/*
+		 * Falling edge of BITCLK, counting continues as it was preset
+		 * with BUS[4] (WFFO) at the last KCOM<- load, or as set by a
+		 * 1 bit being read in HIORDBIT.
+		 */
+		if (WFFO) {
+			/*
+			 * If BUS[4] (WFFO) was 1, both J and K' of the FF (74109) will
+			 * be 1 at the rising edge of LDCOM' (at the end of KCOM<-)
+			 * and Q will be 1. LOAD' is deassterted: count on clock.
+			 */
+			if (++dsk.bitcount > 15)
+				dsk.bitcount = 0;
+			dsk.carry = dsk.bitcount == 15;
+			LOG((log_DSK,3,"	WFFO:1 count bitcount:%2d\n", dsk.bitcount));
+		} else {
+			/*
+			 * If BUS[4] (WFFO) was 0, both J and K' will be 0, and Q
+			 * will be 0. LOAD' is asserted: load on clock.
+			 */
+			dsk.bitcount = 15;
+			dsk.carry = 1;
+			LOG((log_DSK,3,"	WFFO:0 load bitcount:%2d\n", dsk.bitcount));
+		}
+	} else if (!dsk.bitclk && bitclk) {
+		/* clock the shift register on the rising edge of bitclk */
+		dsk.shiftin = (dsk.shiftin << 1) | datin;
+		/* and the output shift register, too */
+		dsk.shiftout = dsk.shiftout << 1;
+	}
+
+	if (wddone0 != wddone1) {
+		LOG((log_DSK,2,"	WDDONE':%d->%d\n", wddone0, wddone1));
+	}
+
+	if (dsk.carry) {
+		/* CARRY = 1 -> WDDONE' = 0 */
+		wddone1 = 0;
+		if (wddone0 == 0) {
+			/*
+			 * Latch a new data word while WDDONE is 0
+			 * Note: The shifter outputs for bits 0 to 14 are connected
+			 * to the latches inputs 1 to 15, while input bit 0 comes
+			 * from the current datin.
+			 * Shifter output 15 is the HIORDBIT signal.
+			 */
+			dsk.datain = dsk.shiftin & 0177777;
+			/* load the output shift register */
+			dsk.shiftout = dsk.dataout;
+			LOG((log_DSK,6," 	LATCH in:%06o (0x%04x) out:%06o (0x%04x)\n",
+			dsk.datain, dsk.datain, dsk.dataout, dsk.dataout));
+		}
+	} else {
+		/* CARRY = 0 -> WDDONE' = 1 */
+		wddone1 = 1;
 	}
 
+	/* remember previous state of wddone */
+	wddone0 = wddone1;
+
+	/**
+	 * JK flip-flop 43b (word task)
+	 * <PRE>
+	 * CLK	WDDONE'
+	 * J	1
+	 * K'	1
+	 * S'	1
+	 * C'	WDTSKENA
+	 * Q	to 53a J
+	 * </PRE>
+	 */
+	DEBUG_NAME("		KWD 43b");
+	dsk.ff_43b = update_jkff(dsk.ff_43b,
+		(wddone1 ? JKFF_CLK : 0) |
+		JKFF_J |
+		JKFF_K |
+		(dsk.ok_to_run ? JKFF_S : 0) |
+		((dsk.ff_43a & JKFF_Q) ? 0 : JKFF_C));
+
+#if	JKFF_FUNCTION
+	kwd_sysclk(&dsk, block == task_kwd, block == task_ksec,
+		WDALLOW, drive_ready_0(dsk.drive), SEQERR);
+#else
+	if (dsk.ff_53b & dsk.ff_53a & dsk.ff_43a & dsk.ff_45a &
+		dsk.ff_45b & dsk.ff_22b & dsk.ff_22a & dsk.ff_21b & JKFF_CLK) {
+		const uint8_t *next = kwd_sysclk_lut[
+			KWD_Q(dsk.ff_53b, KWD_Q_53B) |
+			KWD_Q(dsk.ff_53a, KWD_Q_53A) |
+			KWD_Q(dsk.ff_43a, KWD_Q_43A) |
+			KWD_Q(dsk.ff_45a, KWD_Q_45A) |
+			KWD_Q(dsk.ff_45b, KWD_Q_45B) |
+			KWD_Q(dsk.ff_22b, KWD_Q_22B) |
+			KWD_Q(dsk.ff_22a, KWD_Q_22A) |
+			KWD_Q(dsk.ff_21b, KWD_Q_21B) |
+			KWD_Q(dsk.ff_43b, KWD_Q_43B) |
+			KWD_Q(dsk.ff_21a, KWD_Q_21A) |
+			(block == task_kwd ? KWD_BLK_KWD : 0) |
+			(block == task_ksec ? KWD_BLK_KSEC : 0) |
+			(WDALLOW ? KWD_WDALLOW : 0) |
+			(drive_ready_0(dsk.drive) ? KWD_READY0 : 0) |
+			(SEQERR ? KWD_SEQERR : 0)];
+		dsk.ff_53b = next[0];
+		dsk.ff_53a = next[1];
+		dsk.ff_43a = next[2];
+		dsk.ff_45a = next[3];
+		dsk.ff_45b = next[4];
+		dsk.ff_22b = next[5];
+		dsk.ff_22a = next[6];
+		dsk.ff_21b = next[7];
+	} else {
+		/* first call after reset: not all FFs have seen SYSCLK yet */
+		kwd_sysclk(&dsk, block == task_kwd, block == task_ksec,
+			WDALLOW, drive_ready_0(dsk.drive), SEQERR);
+	}
+#endif
+
 	/* The 53b FF Q output is the WDINIT signal. */
 	if (WDINIT != dsk.wdinit) {
 		dsk.wdinit0 = dsk.wdinit;
@@ -935,9 +1061,8 @@ static void kwd_timing(int bitclk, int datin, int block)
 	 * some time.
 	 */
 	if (!(dsk.ff_21a_old & JKFF_Q) && (dsk.ff_21a & JKFF_Q)) {
-		if (dsk.seclate_id)
-			timer_remove(dsk.seclate_id);
-		dsk.seclate_id = timer_insert(TW_SECLATE, disk_seclate, 1, "seclate");
+		if (timer_reschedule(dsk.seclate_id, TW_SECLATE, 1) < 0)
+			dsk.seclate_id = timer_insert(TW_SECLATE, disk_seclate, 1, "seclate");
 		if (dsk.seclate) {
 			dsk.seclate = 0;
 			LOG((log_DSK,4,"	SECLATE -> 0 pulse until %lldns\n",
@@ -974,7 +1099,7 @@ static void kwd_timing(int bitclk, int datin, int block)
 
 
 /** @brief timer callback to take away the SECLATE pulse (monoflop) */
-static void disk_seclate(int id, int arg)
+static void disk_seclate(timer_id_t id, int arg)
 {
 	LOG((log_DSK,2,"	SECLATE -> %d\n", arg));
 	dsk.seclate = arg;
@@ -982,7 +1107,7 @@ static void disk_seclate(int id, int arg)
 }
 
 /** @brief timer callback to take away the OK TO RUN pulse (reset) */
-static void disk_ok_to_run(int id, int arg)
+static void disk_ok_to_run(timer_id_t id, int arg)
 {
 	LOG((log_DSK,2,"	OK TO RUN -> %d\n", arg));
 	dsk.ok_to_run = arg;
@@ -1008,7 +1133,7 @@ static void disk_ok_to_run(int id, int arg)
  * @param id timer id
  * @param arg contains the drive, cylinder, and restore flag
  */
-static void disk_strobon(int id, int arg)
+static void disk_strobon(timer_id_t id, int arg)
 {
 	int unit = arg % 2;
 	int restore = (arg / 2) % 2;
@@ -1078,7 +1203,7 @@ static void disk_strobon(int id, int arg)
 }
 
 /** @brief timer callback to change the READY monoflop 31a */
-static void disk_ready_mf31a(int id, int arg)
+static void disk_ready_mf31a(timer_id_t id, int arg)
 {
 	dsk.ready_mf31a = arg & drive_ready_0(dsk.drive);
 	/* log the not ready result with level 0, else 2 */
@@ -1694,7 +1819,7 @@ void f2_strobon_1(void)
  * @param id timer id
  * @param arg bit number
  */
-static void disk_bitclk(int id, int arg)
+static void disk_bitclk(timer_id_t id, int arg)
 {
 	int bits = drive_bits_per_sector();
 	int clk = arg & 1;
@@ -1745,9 +1870,12 @@ static void disk_bitclk(int id, int arg)
 
 	/* more bits to clock? */
 	arg++;
-	if (arg < bits)
-		timer_insert(drive_bit_time(dsk.drive), disk_bitclk,
-			arg, "disk bitclk");
+	if (arg < bits) {
+		/* reuse the timer, unless called by disk_sector_start() */
+		if (timer_reschedule(id, drive_bit_time(dsk.drive), arg) < 0)
+			timer_insert_sync(drive_bit_time(dsk.drive), disk_bitclk,
+				arg, "disk bitclk");
+	}
 }
 
 /**
@@ -1799,6 +1927,10 @@ int disk_init(void)
 {
 	memset(&dsk, 0, sizeof(dsk));
 
+#if	!JKFF_FUNCTION
+	kwd_sysclk_init();
+#endif
+
 	dsk.wdtskena = 1;
 
 	dsk.seclate = 0;
@@ -226,8 +226,47 @@ static const uint16_t double_bits[256] = {
 	0xffc0,0xffc3,0xffcc,0xffcf,0xfff0,0xfff3,0xfffc,0xffff
 };
 
+/**
+ * @brief write the changed words of the pending scanline to the screen
+ */
+static void display_flush(void)
+{
+	if (dsp.dirty_y < 0)
+		return;
+	sdl_write_line(dsp.dirty_y, dsp.dirty_x0, dsp.dirty_x1,
+		dsp.raw_bitmap[dsp.dirty_y]);
+	dsp.dirty_y = -1;
+}
+
+/**
+ * @brief store a changed word in the raw bitmap and extend the pending span
+ *
+ * @param x word number in the scanline
+ * @param y scanline number
+ * @param word word to store
+ */
+static __inline void display_store(int x, int y, uint16_t word)
+{
+	dsp.raw_bitmap[y][x] = word;
+	dsp.dirty_words[y] |= (uint64_t)1 << x;
+	if (y != dsp.dirty_y) {
+		display_flush();
+		dsp.dirty_y = y;
+		dsp.dirty_x0 = x;
+		dsp.dirty_x1 = x + 1;
+		return;
+	}
+	if (x < dsp.dirty_x0)
+		dsp.dirty_x0 = x;
+	if (x >= dsp.dirty_x1)
+		dsp.dirty_x1 = x + 1;
+}
+
 /**
  * @brief unload the next word from the display FIFO and shift it to the screen
+ *
+ * Changed words are collected in dsp.raw_bitmap and written to the
+ * screen as one span per scanline, see display_flush().
  */
 int unload_word(int x)
 {
@@ -254,10 +293,8 @@ int unload_word(int x)
 				word1 ^= dsp.curdata >> 16;
 			else if (x == dsp.curword + 1)
 				word1 ^= dsp.curdata & 0177777;
-			if (word1 != dsp.raw_bitmap[y][x]) {
-				dsp.raw_bitmap[y][x] = word1;
-				sdl_write(x * 16, y, word1);
-			}
+			if (word1 != dsp.raw_bitmap[y][x])
+				display_store(x, y, word1);
 			x++;
 			if (x < DISPLAY_VISIBLE_WORDS) {
 				/* mixing with the cursor */
@@ -265,10 +302,8 @@ int unload_word(int x)
 					word2 ^= dsp.curdata >> 16;
 				else if (x == dsp.curword + 1)
 					word2 ^= dsp.curdata & 0177777;
-				if (word2 != dsp.raw_bitmap[y][x]) {
-					dsp.raw_bitmap[y][x] = word2;
-					sdl_write(x * 16, y, word2);
-				}
+				if (word2 != dsp.raw_bitmap[y][x])
+					display_store(x, y, word2);
 				x++;
 			}
 		} else {
@@ -277,10 +312,8 @@ int unload_word(int x)
 				word ^= dsp.curdata >> 16;
 			else if (x == dsp.curword + 1)
 				word ^= dsp.curdata & 0177777;
-			if (word != dsp.raw_bitmap[y][x]) {
-				dsp.raw_bitmap[y][x] = word;
-				sdl_write(x * 16, y, word);
-			}
+			if (word != dsp.raw_bitmap[y][x])
+				display_store(x, y, word);
 			x++;
 		}
 	}
@@ -291,35 +324,253 @@ int unload_word(int x)
 	}
 
 	cpu.unload_time = -1;
+	display_flush();
 	return -1;
 }
 
 
+/** @brief HLCGATE: count the HLC, wake the MRT (and the Ether task) */
+#define	DSP_EV_HLCGATE		0x0001
+/** @brief VBLANK: remember the HLC */
+#define	DSP_EV_VBLANK		0x0002
+/** @brief rising edge of VSYNC: wake the DVT, update the screen */
+#define	DSP_EV_VSYNC		0x0004
+/** @brief falling edge of VBLANK: wake the DHT */
+#define	DSP_EV_VBLANKPULSE	0x0008
+/** @brief falling edge of HBLANK: start unloading words */
+#define	DSP_EV_UNLOAD		0x0010
+/** @brief SCANEND: clear the DWT wakeup */
+#define	DSP_EV_SCANEND		0x0020
+/** @brief rising edge of HSYNC: clear the FIFO (CLRBUF) */
+#define	DSP_EV_CLRBUF		0x0040
+/** @brief falling edge of HSYNC: CURT wakeup */
+#define	DSP_EV_CURT		0x0080
+
+/** @brief pack the inputs of a display step into a key */
+#define	DSP_STEP_KEY(arg,hlc,a63,a66) \
+	((uint32_t)(arg) | ((uint32_t)(hlc) << 5) | ((uint32_t)(a63) << 16) | ((uint32_t)(a66) << 24))
+
+/** @brief index of a key's PROM a63 address and HLC in display_index[] */
+#define	DSP_INDEX(key)		((key) & 0xffff)
+
+/**
+ * @brief one step of the display state machine, decoded from the PROMs
+ */
+typedef struct {
+	/** @brief inputs: a63 address, HLC, previous a63 and a66 */
+	uint32_t key;
+
+	/** @brief DSP_EV_* events of this step */
+	uint16_t events;
+
+	/** @brief HLC after this step */
+	uint16_t hlc;
+
+	/** @brief PROM a63 value */
+	uint8_t a63;
+
+	/** @brief PROM a66 value */
+	uint8_t a66;
+
+	/** @brief next a63 address */
+	uint8_t next;
+
+	/** @brief reserved */
+	uint8_t pad;
+}	display_step_t;
+
+/** @brief the display state machine steps of a frame, see display_schedule() */
+static display_step_t *display_sched;
+
+/** @brief number of steps in display_sched */
+static int display_steps;
+
+/** @brief schedule index of the step following the last step */
+static int display_loop;
+
+/** @brief first schedule index for each a63 address and HLC (-1 if none) */
+static int32_t *display_index;
+
+/** @brief next schedule index with the same a63 address and HLC (-1 if none) */
+static int32_t *display_same;
+
+/**
+ * @brief decode one step of the display state machine from the PROMs
+ *
+ * Everything the step does which depends only on the a63 address, the
+ * HLC, and the previous a63 and a66 values is recorded in the step.
+ *
+ * @param e pointer to the step to fill
+ * @param arg the current displ_a63 PROM address
+ * @param hlc the current HLC
+ * @param a63_prev the previous PROM a63 value
+ * @param a66_prev the previous PROM a66 value
+ */
+static void display_decode(display_step_t *e, int arg, int hlc, int a63_prev, int a66_prev)
+{
+	int a63, a66, vsync, vblank;
+
+	e->key = DSP_STEP_KEY(arg, hlc, a63_prev, a66_prev);
+	e->events = 0;
+	e->pad = 0;
+
+	a63 = displ_a63[arg];
+
+	if (HLCGATE_HI(a63)) {
+		/* reset or count horizontal line counters */
+		if (hlc == DISPLAY_HLC_END)
+			hlc = DISPLAY_HLC_START;
+		else
+			hlc++;
+		e->events |= DSP_EV_HLCGATE;
+	}
+	if (ALTO_BIT(hlc,11,2) || ALTO_BIT(hlc,11,1)) {
+		/* PROM a66 is disabled, if any of HLC256 or HLC512 are high */
+		a66 = 017;
+	} else {
+		/* PROM a66 address lines are connected the HLC1 to HLC128 signals */
+		a66 = displ_a66[hlc & 255];
+	}
+
+	/* next address from PROM a63, use A4 from HLC1 */
+	e->next = (16 * (ALTO_BIT(hlc,11,10) ^ 1)) | A63_NEXT(a63);
+
+	/* see A66_VSYNC and A66_VBLANK: the masks depend on the new HLC1024 */
+	vsync = ALTO_BIT(hlc,11,0) ? 001 : 002;
+	vblank = ALTO_BIT(hlc,11,0) ? 004 : 010;
+
+	if (0 == (a66 & vblank)) {
+		e->events |= DSP_EV_VBLANK;
+		/* VSYNC is always within VBLANK */
+		if (0 == (a66 & vsync) && 0 != (a66_prev & vsync))
+			e->events |= DSP_EV_VSYNC;
+	} else {
+		if (0 == (a66_prev & vblank))
+			e->events |= DSP_EV_VBLANKPULSE;
+		if (HBLANK_LO(a63) && HBLANK_HI(a63_prev))
+			e->events |= DSP_EV_UNLOAD;
+	}
+
+	if (SCANEND_HI(a63))
+		e->events |= DSP_EV_SCANEND;
+
+	if (HSYNC_HI(a63)) {
+		if (HSYNC_LO(a63_prev))
+			e->events |= DSP_EV_CLRBUF;
+	} else if (HSYNC_HI(a63_prev)) {
+		e->events |= DSP_EV_CURT;
+	}
+
+	e->hlc = hlc;
+	e->a63 = a63;
+	e->a66 = a66;
+}
+
+/**
+ * @brief find the schedule index of a step by its key
+ *
+ * @param key the step's inputs, see DSP_STEP_KEY()
+ * @result returns the schedule index, or -1 if the step is not scheduled
+ */
+static int display_find(uint32_t key)
+{
+	int i;
+
+	for (i = display_index[DSP_INDEX(key)]; i >= 0; i = display_same[i])
+		if (display_sched[i].key == key)
+			return i;
+	return -1;
+}
+
+/**
+ * @brief compile the display state machine steps into a schedule
+ *
+ * The PROM driven sequence of steps is the same for every frame. It is
+ * followed from the reset state until a step repeats, which closes the
+ * loop of a frame. The steps are stored in the order they happen, so the
+ * state machine just replays the schedule at run time.
+ */
+static void display_schedule(void)
+{
+	display_step_t e;
+	int arg = 020, hlc = DISPLAY_HLC_START, a63 = 0, a66 = 0;
+	int i, size = 0;
+
+	free(display_sched);
+	display_sched = NULL;
+	free(display_same);
+	display_same = NULL;
+	display_steps = 0;
+	free(display_index);
+	display_index = malloc(65536 * sizeof(*display_index));
+	if (!display_index)
+		fatal(1, "no memory for the display schedule index\n");
+	for (i = 0; i < 65536; i++)
+		display_index[i] = -1;
+
+	for (;;) {
+		i = display_find(DSP_STEP_KEY(arg, hlc, a63, a66));
+		if (i >= 0) {
+			/* closed the loop */
+			display_loop = i;
+			break;
+		}
+		if (display_steps == size) {
+			size = size ? size * 2 : 32 * 1024;
+			display_sched = realloc(display_sched, size * sizeof(*display_sched));
+			display_same = realloc(display_same, size * sizeof(*display_same));
+			if (!display_sched || !display_same)
+				fatal(1, "no memory for the display schedule\n");
+		}
+		display_decode(&e, arg, hlc, a63, a66);
+		i = display_steps++;
+		display_same[i] = display_index[DSP_INDEX(e.key)];
+		display_index[DSP_INDEX(e.key)] = i;
+		display_sched[i] = e;
+		arg = e.next;
+		hlc = e.hlc;
+		a63 = e.a63;
+		a66 = e.a66;
+	}
+	LOG((log_DSP,1,"display schedule: %d steps\n", display_steps));
+}
+
 /**
  * @brief function called by the CPU to enter the next display state
  *
  * There are 32 states per scanline and 875 scanlines per frame.
+ * The steps are replayed from the schedule built by display_schedule();
+ * only the parts depending on the FIFO, the block flags and the
+ * setmode are evaluated here. If the state machine is off the schedule,
+ * e.g. after a soft reset, the step is decoded from the PROMs.
  *
  * @param arg the current displ_a63 PROM address
  * @result returns the next state of the display state machine
  */
 int display_state_machine(int arg)
 {
-	int next, a63, a66;
+	display_step_t tmp;
+	const display_step_t *e;
+	uint32_t key = DSP_STEP_KEY(arg, dsp.hlc, dsp.a63, dsp.a66);
+
+	if (dsp.step < 0 || display_sched[dsp.step].key != key)
+		dsp.step = display_find(key);
+	if (dsp.step >= 0) {
+		e = &display_sched[dsp.step];
+		if (++dsp.step == display_steps)
+			dsp.step = display_loop;
+	} else {
+		display_decode(&tmp, arg, dsp.hlc, dsp.a63, dsp.a66);
+		e = &tmp;
+	}
 
 	LOG((log_DSP,5,"DSP%03o:", arg));
 	if (020 == arg) {
 		LOG((log_DSP,2," HLC=%d", dsp.hlc));
 	}
 
-	a63 = displ_a63[arg];
-
-	if (HLCGATE_HI(a63)) {
-		/* reset or count horizontal line counters */
-		if (dsp.hlc == DISPLAY_HLC_END)
-			dsp.hlc = DISPLAY_HLC_START;
-		else
-			dsp.hlc++;
+	dsp.hlc = e->hlc;
+	if (e->events & DSP_EV_HLCGATE) {
 		/* start the refresh task _twice_ on each scanline */
 		CPU_SET_TASK_WAKEUP(task_mrt);
 		if (cpu.ewfct) {
@@ -327,39 +578,28 @@ int display_state_machine(int arg)
 			CPU_SET_TASK_WAKEUP(task_ether);
 		}
 	}
-	if (HLC256 || HLC512) {
-		/* PROM a66 is disabled, if any of HLC256 or HLC512 are high */
-		a66 = 017;
-	} else {
-		/* PROM a66 address lines are connected the HLC1 to HLC128 signals */
-		a66 = displ_a66[dsp.hlc & 255];
-	}
 
-	/* next address from PROM a63, use A4 from HLC1 */
-	next = (16 * (HLC1 ^ 1)) | A63_NEXT(a63);
-
-	if (VBLANK_HI(a66)) {
+	if (e->events & DSP_EV_VBLANK) {
 		/* VBLANK: remember hlc */
 		dsp.vblank = dsp.hlc | 1;
 
 		LOG((log_DSP,1, " VBLANK"));
 
 		/* VSYNC is always within VBLANK */
-		if (VSYNC_HI(a66)) {
-			if (VSYNC_LO(dsp.a66)) {
-				LOG((log_DSP,1, " VSYNC/ (wake DVT)"));
-				/* 
-				 * The display vertical task DVT is awakened once per field,
-				 * at the beginning of vertical retrace.
-				 */
-				CPU_SET_TASK_WAKEUP(task_dvt);
-				sdl_update(HLC1024);
-			} else {
-				LOG((log_DSP,1, " VSYNC"));
-			}
+		if (e->events & DSP_EV_VSYNC) {
+			LOG((log_DSP,1, " VSYNC/ (wake DVT)"));
+			/* 
+			 * The display vertical task DVT is awakened once per field,
+			 * at the beginning of vertical retrace.
+			 */
+			CPU_SET_TASK_WAKEUP(task_dvt);
+			display_flush();
+			sdl_update(HLC1024);
+		} else if (VSYNC_HI(e->a66)) {
+			LOG((log_DSP,1, " VSYNC"));
 		}
 	} else {
-		if (VBLANK_HI(dsp.a66)) {
+		if (e->events & DSP_EV_VBLANKPULSE) {
 			/**
 			 * VBLANKPULSE:
 			 * The display horizontal task DHT is awakened once at the
@@ -379,7 +619,7 @@ int display_state_machine(int arg)
 			 */
 			dsp.curt_blocks = 0;
 		}
-		if (HBLANK_LO(a63) && HBLANK_HI(dsp.a63)) {
+		if (e->events & DSP_EV_UNLOAD) {
 			/* falling edge of a63 HBLANK starts unload */
 			LOG((log_DSP,1, " HBLANK\\ UNLOAD"));
 			cpu.unload_time = DISPLAY_BITTIME(dsp.halfclock ? 32 : 16);
@@ -405,33 +645,33 @@ int display_state_machine(int arg)
 		}
 	}
 
-	if (SCANEND_HI(a63)) {
+	if (e->events & DSP_EV_SCANEND) {
 		LOG((log_DSP,1, " SCANEND"));
 		CPU_CLR_TASK_WAKEUP(task_dwt);
 	}
 
-	LOG((log_DSP,1, "%s", (a63 & A63_HBLANK) ? " HBLANK": ""));
+	LOG((log_DSP,1, "%s", (e->a63 & A63_HBLANK) ? " HBLANK": ""));
 
-	if (HSYNC_HI(a63)) {
-		if (HSYNC_LO(dsp.a63)) {
-			LOG((log_DSP,1, " HSYNC/ (CLRBUF)"));
-			/*
-			 * The hardware sets the buffer empty and clears the DWT block
-			 * flip-flop at the beginning of horizontal retrace for
-			 * every scanline.
-			 */
-			dsp.fifo_wr = 0;
-			dsp.fifo_rd = 0;
-			dsp.dwt_blocks = 0;
-			/* now take the new values from the last setmode */
-			dsp.inverse = GET_SETMODE_INVERSE(dsp.setmode) ? 0xffff : 0x0000;
-			dsp.halfclock = GET_SETMODE_SPEEDY(dsp.setmode);
-			/* stop the CPU from calling unload_word() */
-			cpu.unload_time = -1;
-		} else {
-			LOG((log_DSP,1, " HSYNC"));
-		}
-	} else if (HSYNC_HI(dsp.a63)) {
+	if (e->events & DSP_EV_CLRBUF) {
+		LOG((log_DSP,1, " HSYNC/ (CLRBUF)"));
+		/*
+		 * The hardware sets the buffer empty and clears the DWT block
+		 * flip-flop at the beginning of horizontal retrace for
+		 * every scanline.
+		 */
+		dsp.fifo_wr = 0;
+		dsp.fifo_rd = 0;
+		dsp.dwt_blocks = 0;
+		/* write what was changed of the last scanline */
+		display_flush();
+		/* now take the new values from the last setmode */
+		dsp.inverse = GET_SETMODE_INVERSE(dsp.setmode) ? 0xffff : 0x0000;
+		dsp.halfclock = GET_SETMODE_SPEEDY(dsp.setmode);
+		/* stop the CPU from calling unload_word() */
+		cpu.unload_time = -1;
+	} else if (HSYNC_HI(e->a63)) {
+		LOG((log_DSP,1, " HSYNC"));
+	} else if (e->events & DSP_EV_CURT) {
 		/*
 		 * CLRBUF' also resets the 2nd cursor task block flip flop,
 		 * which is built from two NAND gates a30c and a30d (74H00).
@@ -446,12 +686,12 @@ int display_state_machine(int arg)
 	}
 
 
-	LOG((log_DSP,1, " NEXT:%03o\n", next));
+	LOG((log_DSP,1, " NEXT:%03o\n", e->next));
 
-	dsp.a63 = a63;
-	dsp.a66 = a66;
+	dsp.a63 = e->a63;
+	dsp.a66 = e->a66;
 
-	return next;
+	return e->next;
 }
 
 /**
@@ -480,19 +720,23 @@ void f2_evenfield_1(void)
  * @brief create a PNG file screenshot from the current raw bitmap
  *
  * @param ptr pointer to a struct png_t
+ * @param bitmap pointer to a copy of the raw bitmap, or NULL for dsp.raw_bitmap
  * @param left left clipping boundary
  * @param top top clipping boundary
  * @param right right clipping boundary (inclusive)
  * @param bottom bottom clipping boundary (inclusive)
  * @result returns 0 on success, -1 on error
  */
-int display_screenshot(void *ptr, int left, int top, int right, int bottom)
+int display_screenshot(void *ptr, const uint16_t *bitmap,
+	int left, int top, int right, int bottom)
 {
 	png_t *png = (png_t *)ptr;
 	int colors[2] = {0,1};
 
+	if (NULL == bitmap)
+		bitmap = &dsp.raw_bitmap[0][0];
 	return png_blit_1bpp(png, 0, 0, left, top, right - left, bottom - top,
-		(uint8_t *)dsp.raw_bitmap, 2*DISPLAY_VISIBLE_WORDS, SRCWORDXOR,
+		(uint8_t *)bitmap, 2*DISPLAY_VISIBLE_WORDS, SRCWORDXOR,
 		colors, 0);
 
 }
@@ -510,6 +754,9 @@ int display_init(void)
 
 	memset(&dsp, 0, sizeof(dsp));
 	dsp.hlc = DISPLAY_HLC_START;
+	dsp.dirty_y = -1;
+	dsp.step = -1;
+	display_schedule();
 
 	for (y = 0; y < DISPLAY_HEIGHT; y++)
 		memset(dsp.raw_bitmap[y], y & 1 ? 0xaa : 0x55,
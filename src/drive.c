@@ -27,6 +27,10 @@
 #include <string.h>
 #include <errno.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <SDL.h>
 
 #include "alto.h"
 #include "cpu.h"
@@ -34,6 +38,8 @@
 #include "debug.h"
 #include "drive.h"
 #include "zcat.h"
+#include "md5.h"
+#include "dov.h"
 
 #define	DIABLO31		1
 
@@ -199,6 +205,152 @@ static const uint32_t clrbit[32] = {
 /** @brief read a bit from an array of unit32_t */
 #define	RDBIT(bits,src) ((bits[(src)>>5] &setbit[(src)&31]) ? 1 : 0)
 
+/** @brief number of uint32_t words in an expanded sector */
+#define	BITS_WORDS	400
+
+/** @brief slack words after an expanded sector for unaligned 64 bit reads */
+#define	BITS_SLACK	2
+
+/** @brief 32 clock and data bits of a 0 word */
+#define	ZERO_BITS	0x55555555ul
+
+/** @brief 32 clock and data bits of the sync word 0x0001 */
+#define	SYNC_BITS	0xd5555555ul
+
+/** @brief result of scan_bits() if the pattern was not found */
+#define	NO_MATCH	((size_t)-1)
+
+/**
+ * @brief expand 8 data bits (MSB first) to 16 interleaved clock and data bits
+ *
+ * Bit 0 of the result is the first clock, bit 1 the data bit for
+ * the byte's bit 7, and so on.
+ */
+static uint16_t expand_lut[256];
+
+/**
+ * @brief squeeze 8 interleaved clock and data bits to 4 data bits (MSB first)
+ */
+static uint8_t squeeze_lut[256];
+
+/** @brief expand a data word into its 32 clock and data bits */
+#define	EXPAND_WORD(word) \
+	((uint32_t)expand_lut[((word) >> 8) & 0377] | \
+	((uint32_t)expand_lut[(word) & 0377] << 16))
+
+/** @brief squeeze 32 clock and data bits into a data word */
+#define	SQUEEZE_WORD(accu) \
+	((squeeze_lut[(accu) & 0377] << 12) | \
+	(squeeze_lut[((accu) >> 8) & 0377] << 8) | \
+	(squeeze_lut[((accu) >> 16) & 0377] << 4) | \
+	squeeze_lut[((accu) >> 24) & 0377])
+
+/** @brief build the expand_lut and squeeze_lut tables */
+static void drive_lut_init(void)
+{
+	int i, bit;
+
+	for (i = 0; i < 256; i++) {
+		uint16_t ex = 0;
+		uint8_t sq = 0;
+		for (bit = 0; bit < 8; bit++) {
+			/* clock bit, followed by the data bit */
+			ex |= 1 << (2 * bit);
+			if (i & (0200 >> bit))
+				ex |= 1 << (2 * bit + 1);
+		}
+		for (bit = 0; bit < 4; bit++) {
+			/* data bits are the odd bits */
+			if (i & (2 << (2 * bit)))
+				sq |= 010 >> bit;
+		}
+		expand_lut[i] = ex;
+		squeeze_lut[i] = sq;
+	}
+}
+
+/**
+ * @brief read 32 bits starting at an arbitrary bit offset
+ *
+ * @param bits pointer to the sector bits
+ * @param src source offset into bits (bit number)
+ * @result the bits src to src+31 in bits 0 to 31
+ */
+static __inline uint32_t rdbits32(const uint32_t *bits, size_t src)
+{
+	size_t i = src >> 5;
+	int sh = src & 31;
+
+	if (0 == sh)
+		return bits[i];
+	return (bits[i] >> sh) | (bits[i + 1] << (32 - sh));
+}
+
+/**
+ * @brief write 32 bits starting at an arbitrary bit offset
+ *
+ * @param bits pointer to the sector bits
+ * @param dst destination offset into bits (bit number)
+ * @param val the bits to write to dst to dst+31
+ */
+static __inline void wrbits32(uint32_t *bits, size_t dst, uint32_t val)
+{
+	size_t i = dst >> 5;
+	int sh = dst & 31;
+
+	if (0 == sh) {
+		bits[i] = val;
+		return;
+	}
+	bits[i] = (bits[i] & ~(0xfffffffful << sh)) | (val << sh);
+	bits[i + 1] = (bits[i + 1] & ~(0xfffffffful >> (32 - sh))) | (val >> (32 - sh));
+}
+
+/**
+ * @brief scan an array of clock and data bits for a 32 bit pattern
+ *
+ * Takes a 64 bit window per 32 bit positions and only compares the
+ * positions where the first two and the last two bits match the
+ * pattern, which skips runs of 0 words without a match in one step.
+ *
+ * @param bits pointer to the sector bits
+ * @param src first bit offset to scan
+ * @param end bit offset after the last bit to scan
+ * @param pattern the 32 bit pattern (first bit in bit 0)
+ * @result bit offset after the pattern, or NO_MATCH
+ */
+static size_t scan_bits(const uint32_t *bits, size_t src, size_t end, uint32_t pattern)
+{
+	if (end > BITS_WORDS * 32)
+		end = BITS_WORDS * 32;
+
+	while (src + 32 <= end) {
+		uint64_t v = (uint64_t)rdbits32(bits, src) |
+			((uint64_t)rdbits32(bits, src + 32) << 32);
+		uint64_t b0 = (pattern & 1) ? v : ~v;
+		uint64_t b1 = (pattern & 2) ? v : ~v;
+		uint64_t b30 = (pattern & (1ul << 30)) ? v : ~v;
+		uint64_t b31 = (pattern & (1ul << 31)) ? v : ~v;
+		uint32_t cand = (uint32_t)(b0 & (b1 >> 1) & (b30 >> 30) & (b31 >> 31));
+
+		while (cand) {
+			uint32_t low = cand & -cand;
+			size_t pos = src;
+			while (!(low & 1)) {
+				low >>= 1;
+				pos++;
+			}
+			if (pos + 32 > end)
+				return NO_MATCH;
+			if (rdbits32(bits, pos) == pattern)
+				return pos + 32;
+			cand &= cand - 1;
+		}
+		src += 32;
+	}
+	return NO_MATCH;
+}
+
 /**
  * @brief format of the cooked disk image sectors, i.e. pure data
  *
@@ -220,6 +372,29 @@ typedef struct {
 }	sector_t;
 
 
+/** @brief default number of expanded sectors cached per drive */
+#define	BITS_CACHE_DEFAULT	64
+
+/**
+ * @brief an expanded sector in a drive's LRU cache
+ */
+typedef struct bits_slot_s {
+	/** @brief the sector's clock and data bits */
+	uint32_t *bits;
+
+	/** @brief page number of the sector, or -1 if the slot is unused */
+	int page;
+
+	/** @brief non-zero if bits were written by a sector write not yet validated */
+	int dirty;
+
+	/** @brief next more recently used slot */
+	struct bits_slot_s *prev;
+
+	/** @brief next less recently used slot */
+	struct bits_slot_s *next;
+}	bits_slot_t;
+
 /** @brief callback to call at the start of each sector */
 static void (*sector_callback)(int);
 
@@ -287,8 +462,80 @@ typedef struct {
 	/** @brief current sector number in track */
 	int sector;
 
-	/** @brief sectors expanded to bits */
-	uint32_t *bits[DRIVE_CYLINDERS * DRIVE_HEADS * DRIVE_SPT];
+	/** @brief cache slots of the sectors expanded to bits, or NULL */
+	bits_slot_t *slot[DRIVE_CYLINDERS * DRIVE_HEADS * DRIVE_SPT];
+
+	/** @brief the cache slots (bits_cache_size entries) */
+	bits_slot_t *cache;
+
+	/** @brief number of cache slots in use */
+	int cached;
+
+	/** @brief most recently used cache slot */
+	bits_slot_t *mru;
+
+	/** @brief least recently used cache slot */
+	bits_slot_t *lru;
+
+	/** @brief memory mapped compressed image file, while it is decoded */
+	void *map;
+
+	/** @brief size of the mapped compressed image file */
+	size_t mapsize;
+
+	/** @brief stream to decode a compressed image, or NULL when done */
+	zstream_t *zs;
+
+	/** @brief number of bytes of the image that are decoded (emulator's view) */
+	size_t cooked;
+
+	/** @brief thread decoding a compressed image, or NULL */
+	SDL_Thread *decoder;
+
+	/** @brief mutex protecting done and finished */
+	SDL_mutex *lock;
+
+	/** @brief condition signalled when the decoder made progress */
+	SDL_cond *progress;
+
+	/** @brief number of bytes of the image the decoder has finished */
+	size_t done;
+
+	/** @brief non-zero when the decoder thread is finished */
+	int finished;
+
+	/** @brief error message if the decoder thread stopped early, or empty */
+	char error[160];
+
+	/** @brief temporary file receiving the decoded image for the cache, or NULL */
+	FILE *zcache;
+
+	/** @brief path name of the temporary cache file */
+	char *zcache_temp;
+
+	/** @brief path name of the cache file */
+	char *zcache_path;
+
+	/** @brief file descriptor of an image that is written back, or -1 */
+	int wbfd;
+
+	/** @brief path name of the image */
+	char *path;
+
+	/** @brief path name of the write back journal (uncompressed images only) */
+	char *journal;
+
+	/** @brief bitmap of the pages changed since the last flush */
+	uint32_t dirty[(DRIVE_PAGES + 31) / 32];
+
+	/** @brief number of pages changed since the last flush */
+	int ndirty;
+
+	/** @brief file descriptor of the overlay for a read-only base image, or -1 */
+	int ovfd;
+
+	/** @brief bitmap of the pages present in the overlay */
+	uint8_t ovbits[(DRIVE_PAGES + 7) / 8];
 
 	/** @brief current page = (cylinder * HEADS + head) * SPT + sector */
 	int page;
@@ -310,13 +557,41 @@ typedef struct {
 static int selected;
 
 /** @brief timer id for drive_sector_mark() and drive_next_sector() */
-static int timer_id;
+static timer_id_t timer_id;
 
 /** @brief dump raw image at exit */
 static int dump_raw;
 
-static void sector_mark_0(int id, int arg);
-static void sector_mark_1(int id, int arg);
+/** @brief maximum number of expanded sectors per drive */
+static int bits_cache_size = BITS_CACHE_DEFAULT;
+
+/** @brief write changed sectors back to the images (every n seconds, if n > 0) */
+static int write_back = -1;
+
+/** @brief default interval for writing back changed sectors in seconds */
+#define	WRITE_BACK_DEFAULT	10
+
+/** @brief non-zero once the write back timer is inserted */
+static int write_back_timer;
+
+/** @brief directory for cached decompressed images, or NULL */
+static const char *zcache_dir;
+
+/** @brief overlay (.dov) file to use for the next image loaded */
+static const char *overlay_next;
+
+/** @brief magic id at the start of a write back journal */
+static const char journal_magic[8] = "SALTOJNL";
+
+/** @brief size of a journal header: magic, page count, and MD5 digest */
+#define	JOURNAL_HEADER	(sizeof(journal_magic) + sizeof(uint32_t) + 32)
+
+/** @brief size of a journal entry: page number and sector */
+#define	JOURNAL_ENTRY	(sizeof(uint32_t) + sizeof(sector_t))
+
+static void sector_mark_0(timer_id_t id, int arg);
+static void sector_mark_1(timer_id_t id, int arg);
+static void drive_drop_write(int unit);
 
 #if	DIABLO31
 static drive_t drive[DRIVE_MAX] = {
@@ -364,6 +639,358 @@ static drive_t drive[DRIVE_MAX] = {
 };
 #endif
 
+/** @brief size of the cooked image in bytes */
+#define	IMAGE_BYTES	(DRIVE_PAGES * sizeof(sector_t))
+
+/** @brief size of a cylinder in the cooked image in bytes */
+#define	CYLINDER_BYTES	(DRIVE_HEADS * DRIVE_SPT * sizeof(sector_t))
+
+/**
+ * @brief check image sectors for sanity
+ *
+ * Verify the C/H/S with the header words and log any mismatches.
+ *
+ * @param unit unit number
+ * @param first first page to check
+ * @param last page after the last page to check
+ */
+static void drive_check_headers(int unit, int first, int last)
+{
+	drive_t *d = &drive[unit];
+	int page, hdr, c, h, s, chs;
+
+	for (page = first; page < last; page++) {
+		c = page / (DRIVE_HEADS * DRIVE_SPT);
+		h = (page / DRIVE_SPT) % DRIVE_HEADS;
+		s = page % DRIVE_SPT;
+		hdr = d->image[page].header[2] + 256 * d->image[page].header[3];
+		chs = (s << 12) | (c << 3) | (h << 2) | (unit << 1);
+		if (chs != hdr) {
+			LOG((log_DRV,0,"WARNING: header mismatch C/H/S: %3d/%d/%2d chs:%06o hdr:%06o\n",
+				c, h, s, chs, hdr));
+		}
+	}
+}
+
+/**
+ * @brief read the overlay's sectors for a range of pages into the image
+ *
+ * @param unit unit number
+ * @param first first page to read
+ * @param last page after the last page to read
+ * @result returns -1 and the failing page in *pfail on error, 0 otherwise
+ */
+static int drive_overlay_apply(int unit, int first, int last, int *pfail)
+{
+	drive_t *d = &drive[unit];
+	int page;
+
+	if (d->ovfd < 0)
+		return 0;
+
+	for (page = first; page < last; page++) {
+		if (!DOV_TEST(d->ovbits, page))
+			continue;
+		if (sizeof(sector_t) != pread(d->ovfd, &d->image[page],
+			sizeof(sector_t), DOV_DATA(page, sizeof(sector_t)))) {
+			*pfail = page;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief store a decoded part of an image in the cache
+ *
+ * @param unit unit number
+ * @param offs offset of the part in bytes
+ * @param size size of the part in bytes
+ */
+static void drive_cache_write(int unit, size_t offs, size_t size)
+{
+	drive_t *d = &drive[unit];
+
+	if (!d->zcache)
+		return;
+	if (1 != fwrite((uint8_t *)d->image + offs, size, 1, d->zcache)) {
+		LOG((log_DRV,0,"failed to write %s (%s)\n", d->zcache_temp, strerror(errno)));
+		fclose(d->zcache);
+		d->zcache = NULL;
+		unlink(d->zcache_temp);
+	}
+}
+
+/**
+ * @brief finish storing a decoded image in the cache
+ *
+ * The image is written to a temporary file, which is renamed when it
+ * is complete, so concurrent instances never see a partial cache entry.
+ *
+ * @param unit unit number
+ * @param complete non-zero if the image was completely decoded
+ */
+static void drive_cache_close(int unit, int complete)
+{
+	drive_t *d = &drive[unit];
+
+	if (d->zcache) {
+		if (fclose(d->zcache) || !complete ||
+			rename(d->zcache_temp, d->zcache_path) < 0) {
+			LOG((log_DRV,0,"failed to store cached image %s\n", d->zcache_path));
+			unlink(d->zcache_temp);
+		} else {
+			LOG((log_DRV,0,"stored cached image %s\n", d->zcache_path));
+		}
+		d->zcache = NULL;
+	}
+	free(d->zcache_temp);
+	d->zcache_temp = NULL;
+	free(d->zcache_path);
+	d->zcache_path = NULL;
+}
+
+/**
+ * @brief thread decoding a compressed image
+ *
+ * The image is decoded one cylinder at a time. Each cylinder is checked,
+ * stored in the cache, and patched from the overlay before it is made
+ * available to the emulator. At the end of the image the stream and
+ * the mapped compressed file are released.
+ *
+ * This thread never calls fatal(), because exit() would run the atexit
+ * handlers here, and they wait for this thread. Errors are recorded in
+ * the drive and reported by drive_decode() on the emulator thread.
+ *
+ * @param arg pointer to the drive
+ * @result returns 0
+ */
+static int drive_decoder(void *arg)
+{
+	drive_t *d = (drive_t *)arg;
+	int unit = (int)(d - drive);
+	size_t offs = 0;
+	int fail;
+
+	while (offs < IMAGE_BYTES) {
+		size_t want = (offs / CYLINDER_BYTES + 1) * CYLINDER_BYTES;
+		size_t first = offs / sizeof(sector_t);
+		off_t got;
+
+		if (want > IMAGE_BYTES)
+			want = IMAGE_BYTES;
+		got = z_read(d->zs, (uint8_t *)d->image + offs, want - offs);
+		if (got < 0) {
+			snprintf(d->error, sizeof(d->error),
+				"failed to decode disk image %s at %ld bytes\n",
+				d->basename, (long)offs);
+			break;
+		}
+		if (0 == got)
+			break;
+		drive_check_headers(unit, first, (offs + got) / sizeof(sector_t));
+		drive_cache_write(unit, offs, got);
+		offs += got;
+		if (drive_overlay_apply(unit, first, offs / sizeof(sector_t), &fail) < 0) {
+			snprintf(d->error, sizeof(d->error),
+				"failed to pread() overlay page #%d (%s)\n",
+				fail, strerror(errno));
+			break;
+		}
+
+		SDL_LockMutex(d->lock);
+		d->done = offs;
+		SDL_CondBroadcast(d->progress);
+		SDL_UnlockMutex(d->lock);
+	}
+	if (!d->error[0]) {
+		uint8_t extra;
+		/* a short or a long image is an error, just like an uncompressed one */
+		if (offs < IMAGE_BYTES || z_read(d->zs, &extra, 1) != 0)
+			snprintf(d->error, sizeof(d->error),
+				"disk image %s size mismatch (%ld bytes)\n",
+				d->basename, (long)offs);
+	}
+	drive_cache_close(unit, !d->error[0]);
+	z_close(d->zs);
+	d->zs = NULL;
+	munmap(d->map, d->mapsize);
+	d->map = NULL;
+	d->mapsize = 0;
+
+	SDL_LockMutex(d->lock);
+	d->finished = 1;
+	SDL_CondBroadcast(d->progress);
+	SDL_UnlockMutex(d->lock);
+	return 0;
+}
+
+/**
+ * @brief start decoding a compressed image on a thread of its own
+ *
+ * @param unit unit number
+ */
+static void drive_decoder_start(int unit)
+{
+	drive_t *d = &drive[unit];
+
+	d->done = 0;
+	d->finished = 0;
+	d->error[0] = '\0';
+	d->lock = SDL_CreateMutex();
+	d->progress = SDL_CreateCond();
+	if (!d->lock || !d->progress)
+		fatal(1, "failed to create the decoder mutex for drive #%d\n", unit);
+	d->decoder = SDL_CreateThread(drive_decoder, d);
+	if (!d->decoder)
+		fatal(1, "failed to create the decoder thread for drive #%d\n", unit);
+}
+
+/**
+ * @brief wait until a compressed image is decoded up to (at least) a given size
+ *
+ * When the decoder thread is finished, it is joined. If exit() was
+ * called on the decoder thread itself, it is not waited for.
+ *
+ * @param unit unit number
+ * @param bytes number of bytes of the image that are needed
+ * @result returns -1 if the decoder stopped at an error, 0 otherwise
+ */
+static int drive_decode_wait(int unit, size_t bytes)
+{
+	drive_t *d = &drive[unit];
+	int finished;
+
+	if (!d->decoder)
+		return d->error[0] ? -1 : 0;
+	if (SDL_GetThreadID(d->decoder) == SDL_ThreadID())
+		return -1;
+
+	if (bytes > IMAGE_BYTES)
+		bytes = IMAGE_BYTES;
+
+	SDL_LockMutex(d->lock);
+	while (d->done < bytes && !d->finished)
+		SDL_CondWait(d->progress, d->lock);
+	d->cooked = d->done;
+	finished = d->finished;
+	SDL_UnlockMutex(d->lock);
+	LOG((log_DRV,1,"	drive #%d decoded %d bytes\n", unit, d->cooked));
+
+	if (finished) {
+		SDL_WaitThread(d->decoder, NULL);
+		d->decoder = NULL;
+		SDL_DestroyCond(d->progress);
+		d->progress = NULL;
+		SDL_DestroyMutex(d->lock);
+		d->lock = NULL;
+		if (d->error[0])
+			return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief wait until a compressed image is decoded up to (at least) a given size
+ *
+ * Reports an error of the decoder thread and exits.
+ *
+ * @param unit unit number
+ * @param bytes number of bytes of the image that are needed
+ */
+static void drive_decode(int unit, size_t bytes)
+{
+	if (drive_decode_wait(unit, bytes) < 0)
+		fatal(1, "%s", drive[unit].error);
+}
+
+/**
+ * @brief wait for all decoder threads at exit
+ *
+ * Errors are only logged, because exit() must not be called again.
+ */
+static void drive_decode_all(void)
+{
+	int unit;
+
+	for (unit = 0; unit < DRIVE_MAX; unit++) {
+		if (drive_decode_wait(unit, IMAGE_BYTES) < 0 && drive[unit].error[0]) {
+			LOG((log_DRV,0,"%s", drive[unit].error));
+		}
+	}
+}
+
+/**
+ * @brief map a cached decompressed image
+ *
+ * @param digest MD5 digest of the compressed image
+ * @result returns the mapped image, or NULL if it is not cached
+ */
+static sector_t *drive_cache_load(const char *digest)
+{
+	char path[FILENAME_MAX];
+	struct stat st;
+	sector_t *image;
+	int fd;
+
+	snprintf(path, sizeof(path), "%s/%s.dsk", zcache_dir, digest);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	if (fstat(fd, &st) < 0 || IMAGE_BYTES != (size_t)st.st_size) {
+		LOG((log_DRV,0,"ignoring cached image %s (%d bytes)\n", path, st.st_size));
+		close(fd);
+		return NULL;
+	}
+	image = (sector_t *)mmap(NULL, IMAGE_BYTES, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (MAP_FAILED == (void *)image)
+		return NULL;
+	LOG((log_DRV,0,"using cached image %s\n", path));
+	return image;
+}
+
+/**
+ * @brief create a temporary file to store a decompressed image in the cache
+ *
+ * @param unit unit number
+ * @param digest MD5 digest of the compressed image
+ */
+static void drive_cache_create(int unit, const char *digest)
+{
+	drive_t *d = &drive[unit];
+	size_t size = strlen(zcache_dir) + strlen(digest) + 32;
+
+	d->zcache_path = (char *)malloc(size);
+	d->zcache_temp = (char *)malloc(size);
+	if (!d->zcache_path || !d->zcache_temp)
+		fatal(1, "failed to malloc(%d) bytes\n", size);
+	mkdir(zcache_dir, 0755);
+	snprintf(d->zcache_path, size, "%s/%s.dsk", zcache_dir, digest);
+	snprintf(d->zcache_temp, size, "%s/%s.%d.tmp", zcache_dir, digest, (int)getpid());
+	d->zcache = fopen(d->zcache_temp, "wb");
+	if (!d->zcache) {
+		LOG((log_DRV,0,"failed to create %s (%s)\n", d->zcache_temp, strerror(errno)));
+	}
+}
+
+/**
+ * @brief return a pointer to a page's sector in the image
+ *
+ * @param unit unit number
+ * @param page page number (0 to DRIVE_PAGES-1)
+ * @result pointer to the sector
+ */
+static __inline sector_t *drive_sector_ptr(int unit, int page)
+{
+	drive_t *d = &drive[unit];
+
+	if ((page + 1) * sizeof(sector_t) > d->cooked)
+		drive_decode(unit, (page + 1) * sizeof(sector_t));
+	return &d->image[page];
+}
+
 /** 
  * @brief calculate the sector from the logical block address
  *
@@ -375,24 +1002,29 @@ static drive_t drive[DRIVE_MAX] = {
 static void drive_get_sector(int unit)
 {
 	drive_t *d = &drive[unit];
+	int page;
+
 	if (unit < 0 || unit >= DRIVE_MAX)
 		fatal(1, "invalid unit %d in call to drive_get_sector()\n", unit);
 
-	/* If there's no image, just reset the page number */
 	if (!d->image) {
-		d->page = -1;
-		return;
-	}
-	if (d->cylinder < 0 || d->cylinder >= DRIVE_CYLINDERS) {
+		/* If there's no image, just reset the page number */
+		page = -1;
+	} else if (d->cylinder < 0 || d->cylinder >= DRIVE_CYLINDERS) {
 		LOG((log_DRV,9,"	DRIVE C/H/S:%d/%d/%d => invalid cylinder\n",
 			d->cylinder, d->head, d->sector));
-		d->page = -1;
-		return;
+		page = -1;
+	} else {
+		/* calculate the new disk relative sector offset */
+		page = DRIVE_PAGE(d->cylinder, d->head, d->sector);
+		LOG((log_DRV,9,"	DRIVE C/H/S:%d/%d/%d => page:%d\n",
+			d->cylinder, d->head, d->sector, page));
 	}
-	/* calculate the new disk relative sector offset */
-	d->page = DRIVE_PAGE(d->cylinder, d->head, d->sector);
-	LOG((log_DRV,9,"	DRIVE C/H/S:%d/%d/%d => page:%d\n",
-		d->cylinder, d->head, d->sector, d->page));
+
+	/* the page changes under a write: it can not complete */
+	if (page != d->page && d->wrfirst >= 0)
+		drive_drop_write(unit);
+	d->page = page;
 }
 
 /** 
@@ -429,13 +1061,9 @@ static size_t expand_zeroes(uint32_t *bits, size_t dst, size_t size)
 {
 	size_t offs;
 
-	for (offs = 0; offs < 32 * size; offs += 2) {
-		/* write the clock bit */
-		WRBIT(bits, dst, 1);
-		dst++;
-		/* write the 0 data bit */
-		WRBIT(bits, dst, 0);
-		dst++;
+	for (offs = 0; offs < size; offs++) {
+		wrbits32(bits, dst, ZERO_BITS);
+		dst += 32;
 	}
 
 	return dst;
@@ -451,22 +1079,10 @@ static size_t expand_zeroes(uint32_t *bits, size_t dst, size_t size)
  */
 static size_t expand_sync(uint32_t *bits, size_t dst, size_t size)
 {
-	size_t offs;
-
-	for (offs = 0; offs < 32 * size - 2; offs += 2) {
-		/* write the clock bit */
-		WRBIT(bits, dst, 1);
-		dst++;
-		/* write the 0 data bit */
-		WRBIT(bits, dst, 0);
-		dst++;
-	}
-	/* write the final clock bit */
-	WRBIT(bits, dst, 1);
-	dst++;
-	/* write the 1 data bit */
-	WRBIT(bits, dst, 1);
-	dst++;
+	dst = expand_zeroes(bits, dst, size - 1);
+	/* the last word has the 1 data bit */
+	wrbits32(bits, dst, SYNC_BITS);
+	dst += 32;
 
 	return dst;
 }
@@ -482,19 +1098,12 @@ static size_t expand_sync(uint32_t *bits, size_t dst, size_t size)
  */
 static size_t expand_record(uint32_t *bits, size_t dst, uint8_t *field, size_t size)
 {
-	size_t offs, bit;
+	size_t offs;
 
 	for (offs = 0; offs < size; offs += 2) {
 		int word = field[size - 2 - offs] + 256 * field[size - 2 - offs + 1];
-		for (bit = 0; bit < 16; bit++) {
-			/* write the clock bit */
-			WRBIT(bits, dst, 1);
-			dst++;
-			/* write the data bit */
-			WRBIT(bits, dst, (word >> 15) & 1);
-			dst++;
-			word <<= 1;
-		}
+		wrbits32(bits, dst, EXPAND_WORD(word));
+		dst += 32;
 	}
 	return dst;
 }
@@ -510,59 +1119,115 @@ static size_t expand_record(uint32_t *bits, size_t dst, uint8_t *field, size_t s
  */
 static size_t expand_cksum(uint32_t *bits, size_t dst, uint8_t *field, size_t size)
 {
-	size_t bit;
 	int word = cksum(field, size, 0521);
 
-	for (bit = 0; bit < 32; bit += 2) {
-		/* write the clock bit */
-		WRBIT(bits, dst, 1);
-		dst++;
-		/* write the data bit */
-		WRBIT(bits, dst, (word >> 15) & 1);
-		dst++;
-		word <<= 1;
-	}
-	return dst;
+	wrbits32(bits, dst, EXPAND_WORD(word));
+	return dst + 32;
 }
 
-/** 
- * @brief Expand a sector into an array of clock and data bits
+/**
+ * @brief unlink a cache slot from the LRU list
+ *
+ * @param d pointer to the drive context
+ * @param slot pointer to the slot
+ */
+static void bits_slot_unlink(drive_t *d, bits_slot_t *slot)
+{
+	if (slot->prev)
+		slot->prev->next = slot->next;
+	else
+		d->mru = slot->next;
+	if (slot->next)
+		slot->next->prev = slot->prev;
+	else
+		d->lru = slot->prev;
+	slot->prev = slot->next = NULL;
+}
+
+/**
+ * @brief link a cache slot as the most recently used
+ *
+ * @param d pointer to the drive context
+ * @param slot pointer to the slot
+ */
+static void bits_slot_touch(drive_t *d, bits_slot_t *slot)
+{
+	if (d->mru == slot)
+		return;
+	if (slot->prev || slot->next || d->lru == slot)
+		bits_slot_unlink(d, slot);
+	slot->next = d->mru;
+	if (d->mru)
+		d->mru->prev = slot;
+	d->mru = slot;
+	if (!d->lru)
+		d->lru = slot;
+}
+
+/**
+ * @brief get a cache slot for a page
+ *
+ * Takes an unused slot while there are any, or else evicts the least
+ * recently used page other than the drive's current page. Writes are
+ * squeezed into the image when they are validated at the end of their
+ * sector, and dropped writes are reverted, so slots are reused as is.
  *
  * @param unit drive unit number (0 or 1)
  * @param page page number (0 to DRIVE_PAGES-1)
+ * @result pointer to the slot, linked as the most recently used
  */
-static void expand_sector(int unit, int page)
+static bits_slot_t *bits_slot_get(int unit, int page)
 {
 	drive_t *d = &drive[unit];
-	sector_t *s;
-	uint32_t *bits;
-	size_t dst;
+	bits_slot_t *slot;
 
-	if (unit < 0 || unit >= DRIVE_MAX)
-		fatal(1, "invalid unit %d in call to expand_sector()\n", unit);
+	if (!d->cache) {
+		d->cache = (bits_slot_t *)calloc(bits_cache_size, sizeof(bits_slot_t));
+		if (!d->cache)
+			fatal(1, "failed to malloc(%d) bytes cache for drive #%d\n",
+				bits_cache_size * sizeof(bits_slot_t), unit);
+	}
 
-	if (page < 0 || page >= DRIVE_PAGES)
-		return;
+	if (d->cached < bits_cache_size) {
+		slot = &d->cache[d->cached++];
+		slot->bits = (uint32_t *)malloc((BITS_WORDS + BITS_SLACK) * sizeof(uint32_t));
+		if (!slot->bits)
+			fatal(1, "failed to malloc(%d) bytes bits for drive #%d page #%d\n",
+				(BITS_WORDS + BITS_SLACK) * sizeof(uint32_t), unit, page);
+	} else {
+		/* never evict the page under the heads */
+		for (slot = d->lru; slot; slot = slot->prev)
+			if (slot->page != d->page)
+				break;
+		if (!slot)
+			fatal(1, "no cache slot to evict for drive #%d page #%d\n",
+				unit, page);
+		LOG((log_DRV,1,"	BITS #%d: evict page #%d\n", unit, slot->page));
+		d->slot[slot->page] = NULL;
+	}
+	slot->page = page;
+	slot->dirty = 0;
+	d->slot[page] = slot;
+	bits_slot_touch(d, slot);
 
-	/* already expanded this sector? */
-	if (d->bits[page])
-		return;
+	return slot;
+}
 
-	if (-1 == page || !d->image) {
-		LOG((log_DRV,0,"	no sector for #%d: %d/%d/%d\n",
-			d->unit, d->cylinder, d->head, d->sector));
-		return;
-	}
+/** 
+ * @brief Expand a sector into an array of clock and data bits
+ *
+ * @param unit drive unit number (0 or 1)
+ * @param page page number (0 to DRIVE_PAGES-1)
+ * @param bits pointer to the bits to fill
+ */
+static void expand_page(int unit, int page, uint32_t *bits)
+{
+	sector_t *s;
+	size_t dst;
 
 	/* get the sector pointer */
-	s = &d->image[page];
-
-	/* allocate a bits image */
-	bits = (uint32_t *)calloc(400, sizeof(uint32_t));
-	if (!bits) {
-		fatal(1, "failed to malloc(%d) bytes bits for drive #%d page #%d\n",
-			sizeof(bits), unit, page);
-	}
+	s = drive_sector_ptr(unit, page);
+	memset(bits, 0, (BITS_WORDS + BITS_SLACK) * sizeof(uint32_t));
 
 #if	DIABLO31
 	/* write sync bit after 31 words - 1 bit */
@@ -601,12 +1266,62 @@ static void expand_sector(int unit, int page)
 	/* fill MWPAL words of clock and 0 data bits */
 	dst = expand_zeroes(bits, dst, MWPAL);
 #endif
-	d->bits[page] = bits;
 
-	LOG((log_DRV,0,"	BITS #%d: %03d/%d/%02d #%-5d bits (@%03d.%02d)\n",
-		d->unit, d->cylinder, d->head, d->sector,
-		dst, dst / 32, dst % 32));
+	LOG((log_DRV,0,"	BITS #%d: page #%d #%-5d bits (@%03d.%02d)\n",
+		unit, page, dst, dst / 32, dst % 32));
+}
+
+/** 
+ * @brief Expand a sector into a cache slot, unless it is cached already
+ *
+ * @param unit drive unit number (0 or 1)
+ * @param page page number (0 to DRIVE_PAGES-1)
+ * @result pointer to the sector's bits, or NULL if there is no sector
+ */
+static uint32_t *expand_sector(int unit, int page)
+{
+	drive_t *d = &drive[unit];
+	uint32_t *bits;
+
+	if (unit < 0 || unit >= DRIVE_MAX)
+		fatal(1, "invalid unit %d in call to expand_sector()\n", unit);
+
+	if (page < 0 || page >= DRIVE_PAGES)
+		return NULL;
+
+	/* already expanded this sector? */
+	if (d->slot[page])
+		return d->slot[page]->bits;
+
+	if (-1 == page || !d->image) {
+		LOG((log_DRV,0,"	no sector for #%d: %d/%d/%d\n",
+			d->unit, d->cylinder, d->head, d->sector));
+		return NULL;
+	}
+
+	/* get a cached bits image */
+	bits = bits_slot_get(unit, page)->bits;
+	expand_page(unit, page, bits);
+
+	return bits;
+}
+
+/**
+ * @brief return the bits of a page, expanding it if it is not cached
+ *
+ * @param unit drive unit number (0 or 1)
+ * @param page page number (0 to DRIVE_PAGES-1)
+ * @result pointer to the sector's bits, or NULL if there is no sector
+ */
+static __inline uint32_t *drive_bits(int unit, int page)
+{
+	drive_t *d = &drive[unit];
+	bits_slot_t *slot = d->slot[page];
 
+	if (!slot)
+		return expand_sector(unit, page);
+	bits_slot_touch(d, slot);
+	return slot->bits;
 }
 
 #if	DEBUG
@@ -665,31 +1380,14 @@ static size_t dump_record(uint8_t *src, size_t addr, size_t size, const char *na
  */
 static size_t squeeze_sync(uint32_t *bits, size_t src, size_t size)
 {
-	size_t offs, bitcount;
-	uint32_t accu = 0;
-	
 	/* hunt for the first 0x0001 word */
-	for (bitcount = 0, offs = 0; offs < size; /* */) {
-		/*
-		 * accumulate clock and data bits until we are
-		 * on the clock bit boundary
-		 */
-		accu = (accu << 1) | RDBIT(bits,src);
-		src++;
-		/*
-		 * look for 15 alternating clocks and 0-bits
-		 * and the 16th clock with a 1-bit
-		 */
-		if (accu == 0xaaaaaaab)
-			return src;
-		if (++bitcount == 32) {
-			bitcount = 0;
-			offs++;
-		}
-	}
+	size_t next = scan_bits(bits, src, src + 32 * size, SYNC_BITS);
+
+	if (NO_MATCH != next)
+		return next;
 	/* return if no sync found within size*32 clock and data bits */
 	LOG((log_DRV,0,"	no sync within %d words\n", size));
-	return src;
+	return src + 32 * size;
 }
 
 /** 
@@ -702,31 +1400,14 @@ static size_t squeeze_sync(uint32_t *bits, size_t src, size_t size)
  */
 static size_t squeeze_unsync(uint32_t *bits, size_t src, size_t size)
 {
-	size_t offs, bitcount;
-	uint32_t accu = 0;
-	
 	/* hunt for the first 0x0000 word */
-	for (bitcount = 0, offs = 0; offs < size; /* */) {
-		/*
-		 * accumulate clock and data bits until we are
-		 * on the clock bit boundary
-		 */
-		accu = (accu << 1) | RDBIT(bits,src);
-		src++;
-		/*
-		 * look for 15 alternating clocks and 0-bits
-		 * and the 16th clock with a 1-bit
-		 */
-		if (accu == 0xaaaaaaaa)
-			return src;
-		if (++bitcount == 32) {
-			bitcount = 0;
-			offs++;
-		}
-	}
+	size_t next = scan_bits(bits, src, src + 32 * size, ZERO_BITS);
+
+	if (NO_MATCH != next)
+		return next;
 	/* return if no sync found within size*32 clock and data bits */
 	LOG((log_DRV,0,"	no unsync within %d words\n", size));
-	return src;
+	return src + 32 * size;
 }
 
 /** 
@@ -740,24 +1421,14 @@ static size_t squeeze_unsync(uint32_t *bits, size_t src, size_t size)
  */
 static size_t squeeze_record(uint32_t *bits, size_t src, uint8_t *field, size_t size)
 {
-	size_t offs, bitcount;
-	uint32_t accu = 0;
-
-	
-	for (bitcount = 0, offs = 0; offs < size; /* */) {
-		/* skip clock */
-		src++;
-		/* get data bit */
-		accu = (accu << 1) | RDBIT(bits,src);
-		src++;
-		bitcount += 2;
-		if (bitcount == 32) {
-			/* collected a word */
-			field[size - 2 - offs + 0] = accu % 256;
-			field[size - 2 - offs + 1] = accu / 256;
-			offs += 2;
-			bitcount = 0;
-		}
+	size_t offs;
+
+	for (offs = 0; offs < size; offs += 2) {
+		uint32_t accu = rdbits32(bits, src);
+		int word = SQUEEZE_WORD(accu);
+		field[size - 2 - offs + 0] = word % 256;
+		field[size - 2 - offs + 1] = word / 256;
+		src += 32;
 	}
 	return src;
 }
@@ -772,34 +1443,123 @@ static size_t squeeze_record(uint32_t *bits, size_t src, uint8_t *field, size_t
  */
 static size_t squeeze_cksum(uint32_t *bits, size_t src, int *cksum)
 {
-	size_t bitcount;
-	uint32_t accu = 0;
-
-	
-	for (bitcount = 0; bitcount < 32; bitcount += 2) {
-		/* skip clock */
-		src++;
-		/* get data bit */
-		accu = (accu << 1) | RDBIT(bits,src);
-		src++;
-	}
+	uint32_t accu = rdbits32(bits, src);
 
 	/* set the cksum to the extracted word */
-	*cksum = accu;
-	return src;
+	*cksum = SQUEEZE_WORD(accu);
+	return src + 32;
 }
 
 /** 
- * @brief squeeze a array of clock and data bits into a sector's data
+ * @brief squeeze a array of clock and data bits into a page's data
+ *
+ * @param unit drive unit number (0 or 1)
+ * @param page page number (0 to DRIVE_PAGES-1)
+ * @param bits pointer to the page's bits
  */
-static void squeeze_sector(int unit)
+static void squeeze_page(int unit, int page, uint32_t *bits)
 {
-	drive_t *d = &drive[unit];
 	sector_t *s;
-	uint32_t *bits;
 	size_t src;
 	int cksum_header, cksum_label, cksum_data;
 
+	/* get the sector pointer */
+	s = drive_sector_ptr(unit, page);
+
+	/* remember the page for the next flush */
+	if (!(drive[unit].dirty[page / 32] & setbit[page % 32])) {
+		drive[unit].dirty[page / 32] |= setbit[page % 32];
+		drive[unit].ndirty++;
+	}
+
+	/* zap the sector first */
+	memset(s->header, 0, sizeof(s->header));
+	memset(s->label, 0, sizeof(s->label));
+	memset(s->data, 0, sizeof(s->data));
+
+	src = MFRRDL * 32;
+	/* skip first words and garbage until 0 bits are coming in */
+	src = squeeze_unsync(bits, src, 40);
+	/* sync on header preamble */
+	src = squeeze_sync(bits, src, 40);
+	LOG((log_DRV,0,"	header sync bit #%d (@%03d.%02d)\n",
+		src, src / 32, src % 32));
+	src = squeeze_record(bits, src, s->header, sizeof(s->header));
+	src = squeeze_cksum(bits, src, &cksum_header);
+#if	DEBUG
+	dump_record(s->header, 0, sizeof(s->header), "header", 0);
+#endif
+
+	/* skip garbage until 0 bits are coming in */
+	src = squeeze_unsync(bits, src, 40);
+	/* sync on label preamble */
+	src = squeeze_sync(bits, src, 40);
+	LOG((log_DRV,0,"	label  sync bit #%d (@%03d.%02d)\n",
+		src, src / 32, src % 32));
+	src = squeeze_record(bits, src, s->label, sizeof(s->label));
+	src = squeeze_cksum(bits, src, &cksum_label);
+#if	DEBUG
+	dump_record(s->label, 0, sizeof(s->label), "label", 0);
+#endif
+
+	/* skip garbage until 0 bits are coming in */
+	src = squeeze_unsync(bits, src, 40);
+	/* sync on data preamble */
+	src = squeeze_sync(bits, src, 40);
+	LOG((log_DRV,0,"	data   sync bit #%d (@%03d.%02d)\n",
+		src, src / 32, src % 32));
+	src = squeeze_record(bits, src, s->data, sizeof(s->data));
+	src = squeeze_cksum(bits, src, &cksum_data);
+#if	DEBUG
+	dump_record(s->data, 0, sizeof(s->data), "data", 1);
+#endif
+
+	/* TODO: what is the cksum start value for the data record? */
+	cksum_header ^= cksum(s->header, sizeof(s->header), 0521);
+	cksum_label ^= cksum(s->label, sizeof(s->label), 0521);
+	cksum_data ^= cksum(s->data, sizeof(s->data), 0521);
+
+	if (cksum_header || cksum_label || cksum_data) {
+#if	DEBUG
+		LOG((log_DRV,0,"	cksum check - header:%06o label:%06o data:%06o\n",
+			cksum_header, cksum_label, cksum_data));
+#else
+		printf("	cksum check - header:%06o label:%06o data:%06o\n",
+			cksum_header, cksum_label, cksum_data);
+#endif
+	}
+}
+
+/** 
+ * @brief drop the current write, reverting the page's bits to the image
+ *
+ * @param unit drive unit number (0 or 1)
+ */
+static void drive_drop_write(int unit)
+{
+	drive_t *d = &drive[unit];
+	bits_slot_t *slot;
+
+	d->wrfirst = -1;
+	d->wrlast = -1;
+	if (d->page < 0 || d->page >= DRIVE_PAGES)
+		return;
+	slot = d->slot[d->page];
+	if (!slot || !slot->dirty)
+		return;
+	LOG((log_DRV,0,"	BITS #%d: drop write to page #%d\n", unit, d->page));
+	expand_page(unit, d->page, slot->bits);
+	slot->dirty = 0;
+}
+
+/** 
+ * @brief squeeze the current sector's bits, if it was written to
+ */
+static void squeeze_sector(int unit)
+{
+	drive_t *d = &drive[unit];
+	bits_slot_t *slot;
+
 	if (unit < 0 || unit >= DRIVE_MAX)
 		fatal(1, "invalid unit %d in call to squeeze_sector()\n", unit);
 
@@ -821,9 +1581,8 @@ static void squeeze_sector(int unit)
 	}
 
 	/* did write into the next sector (?) */
-	if (d->wrlast > d->wrfirst && d->wrlast < 256) {
-		d->wrfirst = -1;
-		d->wrlast = -1;
+	if (d->wrlast > d->wrfirst && d->wrlast < 256) {
+		drive_drop_write(unit);
 		return;
 	}
 
@@ -843,75 +1602,18 @@ static void squeeze_sector(int unit)
 		return;
 	}
 
-	/* get the sector pointer */
-	s = &d->image[d->page];
-
-	/* get the bits pointer */
-	bits = d->bits[d->page];
+	/* get the cache slot */
+	slot = d->slot[d->page];
 
 	/* no bits to write? */
-	if (!bits) {
+	if (!slot) {
 		LOG((log_DRV,0,"	no sector for #%d: %d/%d/%d\n",
 			d->unit, d->cylinder, d->head, d->sector));
 		return;
 	}
 
-	/* zap the sector first */
-	memset(s->header, 0, sizeof(s->header));
-	memset(s->label, 0, sizeof(s->label));
-	memset(s->data, 0, sizeof(s->data));
-
-	src = MFRRDL * 32;
-	/* skip first words and garbage until 0 bits are coming in */
-	src = squeeze_unsync(bits, src, 40);
-	/* sync on header preamble */
-	src = squeeze_sync(bits, src, 40);
-	LOG((log_DRV,0,"	header sync bit #%d (@%03d.%02d)\n",
-		src, src / 32, src % 32));
-	src = squeeze_record(bits, src, s->header, sizeof(s->header));
-	src = squeeze_cksum(bits, src, &cksum_header);
-#if	DEBUG
-	dump_record(s->header, 0, sizeof(s->header), "header", 0);
-#endif
-
-	/* skip garbage until 0 bits are coming in */
-	src = squeeze_unsync(bits, src, 40);
-	/* sync on label preamble */
-	src = squeeze_sync(bits, src, 40);
-	LOG((log_DRV,0,"	label  sync bit #%d (@%03d.%02d)\n",
-		src, src / 32, src % 32));
-	src = squeeze_record(bits, src, s->label, sizeof(s->label));
-	src = squeeze_cksum(bits, src, &cksum_label);
-#if	DEBUG
-	dump_record(s->label, 0, sizeof(s->label), "label", 0);
-#endif
-
-	/* skip garbage until 0 bits are coming in */
-	src = squeeze_unsync(bits, src, 40);
-	/* sync on data preamble */
-	src = squeeze_sync(bits, src, 40);
-	LOG((log_DRV,0,"	data   sync bit #%d (@%03d.%02d)\n",
-		src, src / 32, src % 32));
-	src = squeeze_record(bits, src, s->data, sizeof(s->data));
-	src = squeeze_cksum(bits, src, &cksum_data);
-#if	DEBUG
-	dump_record(s->data, 0, sizeof(s->data), "data", 1);
-#endif
-
-	/* TODO: what is the cksum start value for the data record? */
-	cksum_header ^= cksum(s->header, sizeof(s->header), 0521);
-	cksum_label ^= cksum(s->label, sizeof(s->label), 0521);
-	cksum_data ^= cksum(s->data, sizeof(s->data), 0521);
-
-	if (cksum_header || cksum_label || cksum_data) {
-#if	DEBUG
-		LOG((log_DRV,0,"	cksum check - header:%06o label:%06o data:%06o\n",
-			cksum_header, cksum_label, cksum_data));
-#else
-		printf("	cksum check - header:%06o label:%06o data:%06o\n",
-			cksum_header, cksum_label, cksum_data);
-#endif
-	}
+	squeeze_page(unit, d->page, slot->bits);
+	slot->dirty = 0;
 }
 
 /** 
@@ -1358,11 +2060,8 @@ void drive_wrdata(int unit, int index, int wrdata)
 		return;
 	}
 
-	bits = d->bits[d->page];
+	bits = drive_bits(unit, d->page);
 	if (!bits) {
-		/* expand the sector to bits */
-		expand_sector(unit, d->page);
-		bits = d->bits[d->page];
 		/* just to be safe */
 		if (!bits)
 			fatal(1, "No bits for drive #%d page #%d\n", unit, d->page);
@@ -1379,6 +2078,7 @@ void drive_wrdata(int unit, int index, int wrdata)
 		/* don't write in the guard zone (?) */
 	} else {
 		WRBIT(bits,index,wrdata);
+		d->slot[d->page]->dirty = 1;
 	}
 	d->wrlast = index;
 }
@@ -1417,11 +2117,8 @@ int drive_rddata(int unit, int index)
 		return 1;
 	}
 
-	bits = d->bits[d->page];
+	bits = drive_bits(unit, d->page);
 	if (!bits) {
-		/* expand the sector to bits */
-		expand_sector(unit, d->page);
-		bits = d->bits[d->page];
 		/* just to be safe */
 		if (!bits)
 			fatal(1, "No bits for drive #%d page #%d\n", unit, d->page);
@@ -1467,11 +2164,8 @@ int drive_rdclk(int unit, int index)
 		return 1;
 	}
 
-	bits = d->bits[d->page];
+	bits = drive_bits(unit, d->page);
 	if (!bits) {
-		/* expand the sector to bits */
-		expand_sector(unit, d->page);
-		bits = d->bits[d->page];
 		/* just to be safe */
 		if (!bits)
 			fatal(1, "No bits for drive #%d page #%d\n", unit, d->page);
@@ -1504,40 +2198,32 @@ int drive_rdclk(int unit, int index)
  */
 int debug_read_sync(int unit, int page, int offs)
 {
-	drive_t *d = &drive[unit];
 	uint32_t *bits;
-	uint32_t accu;
+	size_t next;
 
 	if (unit < 0 || unit > 1)
 		return 0;
 
 	/* don't read before or beyond the sector */
-	if (offs < 0 || offs >= 400*32)
+	if (offs < 0 || offs >= BITS_WORDS * 32)
 		return 0;
 
 	/* check for invalid page */
 	if (page < 0 || page >= DRIVE_CYLINDERS * DRIVE_HEADS * DRIVE_SPT)
 		return 0;
 
-	bits = d->bits[page];
+	bits = drive_bits(unit, page);
 	if (!bits) {
-		/* expand the sector to bits */
-		expand_sector(unit, page);
-		bits = d->bits[page];
 		/* just to be safe */
 		if (!bits)
 			return 0;
 	}
 
-	accu = 0;
-	while (offs < 400 * 32) {
-		accu = (accu << 1) | RDBIT(bits,offs);
-		offs++;
-		if (accu == 0xaaaaaaab)
-			break;
-	}
+	next = scan_bits(bits, offs, BITS_WORDS * 32, SYNC_BITS);
+	if (NO_MATCH == next)
+		return BITS_WORDS * 32;
 
-	return offs;
+	return next;
 }
 
 /** 
@@ -1550,37 +2236,30 @@ int debug_read_sync(int unit, int page, int offs)
  */
 int debug_read_sec(int unit, int page, int offs)
 {
-	drive_t *d = &drive[unit];
 	uint32_t *bits;
-	int i, clks, word;
+	uint32_t accu;
 
 	if (unit < 0 || unit > 1)
 		return 0177777;
 
 	/* don't read before or beyond the sector */
-	if (offs < 0 || offs >= 400*32)
+	if (offs < 0 || offs >= BITS_WORDS * 32)
 		return 0177777;
 
 	/* check for invalid page */
 	if (page < 0 || page >= DRIVE_CYLINDERS * DRIVE_HEADS * DRIVE_SPT)
 		return 0177777;
 
-	bits = d->bits[page];
+	bits = drive_bits(unit, page);
 	if (!bits) {
-		/* expand the sector to bits */
-		expand_sector(unit, page);
-		bits = d->bits[page];
 		/* just to be safe */
 		if (!bits)
 			return 0177777;
 	}
 
-	for (i = 0, clks = 0, word = 0; i < 16; i++, offs += 2) {
-		clks = (clks << 1) | RDBIT(bits,offs);
-		word = (word << 1) | RDBIT(bits,offs+1);
-	}
+	accu = rdbits32(bits, offs);
 
-	return word;
+	return SQUEEZE_WORD(accu);
 }
 
 /** 
@@ -1589,7 +2268,7 @@ int debug_read_sec(int unit, int page, int offs)
  * @param id timer id
  * @param arg argument supplied to timer_insert (unused)
  */
-static void drive_next_sector(int id, int arg)
+static void drive_next_sector(timer_id_t id, int arg)
 {
 	int unit = selected;
 	drive_t *d = &drive[unit];
@@ -1617,7 +2296,7 @@ static void drive_next_sector(int id, int arg)
  * @param id timer id
  * @param arg drive unit number
  */
-static void sector_mark_1(int id, int arg)
+static void sector_mark_1(timer_id_t id, int arg)
 {
 	int unit = arg;
 	drive_t *d = &drive[unit];
@@ -1636,7 +2315,7 @@ static void sector_mark_1(int id, int arg)
  * @param id timer id
  * @param arg drive unit number
  */
-static void sector_mark_0(int id, int arg)
+static void sector_mark_0(timer_id_t id, int arg)
 {
 	int unit = arg;
 	drive_t *d = &drive[unit];
@@ -1665,6 +2344,415 @@ static void sector_mark_0(int id, int arg)
 		drive_next_sector, unit, "next sector");
 }
 
+/**
+ * @brief write a buffer to a file descriptor at an offset
+ *
+ * @param fd file descriptor
+ * @param buff pointer to the data
+ * @param size number of bytes to write
+ * @param offs file offset
+ * @result returns 0 on success, -1 on error
+ */
+static int pwrite_all(int fd, const void *buff, size_t size, off_t offs)
+{
+	const uint8_t *bp = (const uint8_t *)buff;
+
+	while (size > 0) {
+		ssize_t done = pwrite(fd, bp, size, offs);
+		if (done < 0) {
+			if (EINTR == errno)
+				continue;
+			return -1;
+		}
+		bp += done;
+		offs += done;
+		size -= done;
+	}
+	return 0;
+}
+
+/**
+ * @brief sync the directory containing a file
+ *
+ * This makes a newly created file, like a journal, survive a crash.
+ *
+ * @param path path name of the file
+ * @result returns 0 on success, -1 on error
+ */
+static int fsync_dir(const char *path)
+{
+	char *dir = strdup(path);
+	char *p;
+	int fd, rc;
+
+	if (!dir)
+		return -1;
+	p = strrchr(dir, '/');
+	if (p == dir)
+		p[1] = '\0';
+	else if (p)
+		p[0] = '\0';
+	fd = open(p ? dir : ".", O_RDONLY);
+	free(dir);
+	if (fd < 0)
+		return -1;
+	rc = fsync(fd);
+	close(fd);
+	return rc;
+}
+
+/**
+ * @brief file offset of a page's sector in an image or in an overlay
+ *
+ * @param overlay non-zero for an overlay
+ * @param page page number
+ * @result returns the file offset
+ */
+static off_t drive_page_offs(int overlay, uint32_t page)
+{
+	if (overlay)
+		return DOV_DATA(page, sizeof(sector_t));
+	return (off_t)page * sizeof(sector_t);
+}
+
+/**
+ * @brief replay a write back journal left over by a crash
+ *
+ * A journal is only applied if it is complete and its MD5 digest
+ * matches. Otherwise the crash happened before the image was touched,
+ * and the journal is just removed. For an overlay, the replayed pages
+ * are also marked in its bitmap.
+ *
+ * @param fd file descriptor of the image or overlay
+ * @param journal path name of the journal
+ * @param overlay non-zero if fd is an overlay
+ */
+static void drive_journal_replay(int fd, const char *journal, int overlay)
+{
+	FILE *fp;
+	uint8_t *buff;
+	uint32_t count, n, page;
+	uint8_t bits[(DRIVE_PAGES + 7) / 8];
+	long size;
+
+	fp = fopen(journal, "rb");
+	if (!fp)
+		return;
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	buff = (uint8_t *)malloc(size + 1);
+	if (!buff)
+		fatal(1, "failed to malloc(%d) bytes\n", size);
+	if (size != (long)fread(buff, 1, size, fp))
+		size = 0;
+	fclose(fp);
+
+	if (size < (long)JOURNAL_HEADER ||
+		memcmp(buff, journal_magic, sizeof(journal_magic))) {
+		LOG((log_DRV,0,"ignoring invalid journal %s\n", journal));
+		goto done;
+	}
+	memcpy(&count, buff + sizeof(journal_magic), sizeof(count));
+	if ((size_t)size != JOURNAL_HEADER + count * JOURNAL_ENTRY ||
+		memcmp(buff + JOURNAL_HEADER - 32,
+			md5_digest(buff + JOURNAL_HEADER, count * JOURNAL_ENTRY), 32)) {
+		LOG((log_DRV,0,"ignoring incomplete journal %s\n", journal));
+		goto done;
+	}
+
+	printf("replaying %u sectors from journal %s\n", count, journal);
+	if (overlay && sizeof(bits) != pread(fd, bits, sizeof(bits), DOV_BITMAP))
+		fatal(1, "failed to read overlay bitmap (%s)\n", strerror(errno));
+	for (n = 0; n < count; n++) {
+		uint8_t *entry = buff + JOURNAL_HEADER + n * JOURNAL_ENTRY;
+		memcpy(&page, entry, sizeof(page));
+		if (page >= DRIVE_PAGES)
+			continue;
+		if (pwrite_all(fd, entry + sizeof(page), sizeof(sector_t),
+			drive_page_offs(overlay, page)) < 0)
+			fatal(1, "failed to pwrite() journal page #%u (%s)\n",
+				page, strerror(errno));
+		if (overlay)
+			DOV_MARK(bits, page);
+	}
+	if (fsync(fd) < 0)
+		fatal(1, "failed to fsync() (%s)\n", strerror(errno));
+	if (overlay && (pwrite_all(fd, bits, sizeof(bits), DOV_BITMAP) < 0 ||
+		fsync(fd) < 0))
+		fatal(1, "failed to write overlay bitmap (%s)\n", strerror(errno));
+
+done:
+	free(buff);
+	unlink(journal);
+}
+
+/**
+ * @brief read and verify an overlay file header
+ *
+ * @param fd file descriptor of the overlay
+ * @param hdr pointer to a header to fill
+ * @result returns 0 on success, -1 if the file is no valid overlay
+ */
+static int drive_overlay_header(int fd, dov_header_t *hdr)
+{
+	if (sizeof(*hdr) != pread(fd, hdr, sizeof(*hdr), 0))
+		return -1;
+	if (memcmp(hdr->magic, DOV_MAGIC, sizeof(hdr->magic)))
+		return -1;
+	if (DOV_VERSION != hdr->version ||
+		DRIVE_PAGES != hdr->pages ||
+		sizeof(sector_t) != hdr->sector_size)
+		return -1;
+	hdr->base[sizeof(hdr->base) - 1] = '\0';
+	return 0;
+}
+
+/**
+ * @brief open or create the overlay for a drive's read-only base image
+ *
+ * @param unit unit number
+ * @param path path name of the overlay
+ * @param base path name of the base image
+ */
+static void drive_overlay_open(int unit, const char *path, const char *base)
+{
+	drive_t *d = &drive[unit];
+	dov_header_t hdr;
+	struct stat st;
+	char *real;
+	int fd;
+
+	fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		fatal(1, "failed to open(%s) (%s)\n", path, strerror(errno));
+	if (fstat(fd, &st) < 0)
+		fatal(1, "failed to fstat(%s) (%s)\n", path, strerror(errno));
+
+	real = realpath(base, NULL);
+	if (!real)
+		fatal(1, "failed to realpath(%s) (%s)\n", base, strerror(errno));
+
+	if (0 == st.st_size) {
+		/* a new, empty overlay */
+		memset(&hdr, 0, sizeof(hdr));
+		memcpy(hdr.magic, DOV_MAGIC, sizeof(hdr.magic));
+		hdr.version = DOV_VERSION;
+		hdr.pages = DRIVE_PAGES;
+		hdr.sector_size = sizeof(sector_t);
+		if (strlen(real) >= sizeof(hdr.base))
+			fatal(1, "base image path name too long: %s\n", real);
+		strcpy(hdr.base, real);
+		if (pwrite_all(fd, &hdr, sizeof(hdr), 0) < 0 ||
+			ftruncate(fd, DOV_DATA_START) < 0 || fsync(fd) < 0)
+			fatal(1, "failed to create overlay %s (%s)\n",
+				path, strerror(errno));
+		LOG((log_DRV,0,"created overlay %s for %s\n", path, real));
+	} else {
+		if (drive_overlay_header(fd, &hdr) < 0)
+			fatal(1, "%s is not a valid overlay for this drive\n", path);
+		if (strcmp(hdr.base, real))
+			printf("WARNING: overlay %s was created for %s\n", path, hdr.base);
+	}
+	free(real);
+
+	/* the overlay has its own journal, which is replayed before the bitmap is read */
+	free(d->journal);
+	d->journal = (char *)malloc(strlen(path) + 9);
+	if (!d->journal)
+		fatal(1, "failed to malloc(%d) bytes\n", strlen(path) + 9);
+	sprintf(d->journal, "%s.journal", path);
+	drive_journal_replay(fd, d->journal, 1);
+
+	if (sizeof(d->ovbits) != pread(fd, d->ovbits, sizeof(d->ovbits), DOV_BITMAP))
+		fatal(1, "failed to read overlay bitmap of %s\n", path);
+	d->ovfd = fd;
+}
+
+/**
+ * @brief write the pages changed since the last flush back to the image
+ *
+ * Drives with an overlay write to the overlay instead.
+ * The changed sectors are first written to a journal, which is synced
+ * before the image (or the overlay's sectors and bitmap) is written and
+ * synced. The journal is removed last, so a crash at any time leaves
+ * either the old image, or a complete journal that is replayed the next
+ * time the image (or overlay) is loaded.
+ *
+ * Errors are reported, but not fatal, because this is also called at
+ * exit. The changed pages are kept to be written again.
+ *
+ * @param unit unit number
+ * @result returns the number of pages written, or -1 on error
+ */
+int drive_flush(int unit)
+{
+	drive_t *d = &drive[unit];
+	uint8_t *buff, *entry;
+	uint32_t count, page;
+	FILE *fp;
+	int overlay = d->ovfd >= 0;
+	int fd = overlay ? d->ovfd : d->wbfd;
+	int failed;
+
+	if (unit < 0 || unit >= DRIVE_MAX)
+		fatal(1, "invalid unit %d in call to drive_flush()\n", unit);
+
+	if (0 == d->ndirty)
+		return 0;
+
+	if (fd < 0)
+		return 0;
+
+	count = d->ndirty;
+	buff = (uint8_t *)malloc(JOURNAL_HEADER + count * JOURNAL_ENTRY);
+	if (!buff) {
+		fprintf(stderr, "failed to malloc(%d) bytes\n",
+			(int)(JOURNAL_HEADER + count * JOURNAL_ENTRY));
+		return -1;
+	}
+
+	/* collect the changed sectors */
+	entry = buff + JOURNAL_HEADER;
+	for (page = 0; page < DRIVE_PAGES; page++) {
+		if (!(d->dirty[page / 32] & setbit[page % 32]))
+			continue;
+		memcpy(entry, &page, sizeof(page));
+		memcpy(entry + sizeof(page), &d->image[page], sizeof(sector_t));
+		entry += JOURNAL_ENTRY;
+	}
+	memcpy(buff, journal_magic, sizeof(journal_magic));
+	memcpy(buff + sizeof(journal_magic), &count, sizeof(count));
+	memcpy(buff + JOURNAL_HEADER - 32,
+		md5_digest(buff + JOURNAL_HEADER, count * JOURNAL_ENTRY), 32);
+
+	/* 1st: write and sync the journal, and the directory entry */
+	fp = fopen(d->journal, "wb");
+	if (!fp) {
+		fprintf(stderr, "failed to fopen() %s (%s)\n", d->journal, strerror(errno));
+		free(buff);
+		return -1;
+	}
+	failed = 1 != fwrite(buff, JOURNAL_HEADER + count * JOURNAL_ENTRY, 1, fp) ||
+		fflush(fp) || fsync(fileno(fp));
+	if (fclose(fp))
+		failed = 1;
+	if (failed || fsync_dir(d->journal) < 0) {
+		fprintf(stderr, "failed to write journal %s (%s)\n", d->journal, strerror(errno));
+		/* the image is untouched; an incomplete journal is useless */
+		unlink(d->journal);
+		free(buff);
+		return -1;
+	}
+
+	/* 2nd: write and sync the changed sectors in place */
+	for (entry = buff + JOURNAL_HEADER; entry < buff + JOURNAL_HEADER + count * JOURNAL_ENTRY;
+		entry += JOURNAL_ENTRY) {
+		memcpy(&page, entry, sizeof(page));
+		if (pwrite_all(fd, entry + sizeof(page), sizeof(sector_t),
+			drive_page_offs(overlay, page)) < 0)
+			break;
+	}
+	if (entry < buff + JOURNAL_HEADER + count * JOURNAL_ENTRY || fsync(fd) < 0) {
+		/* keep the journal: it is replayed the next time the image is loaded */
+		fprintf(stderr, "failed to write back page #%u (%s)\n",
+			page, strerror(errno));
+		free(buff);
+		return -1;
+	}
+
+	/* ... and for an overlay, mark the pages present in its bitmap */
+	if (overlay) {
+		for (page = 0; page < DRIVE_PAGES; page++)
+			if (d->dirty[page / 32] & setbit[page % 32])
+				DOV_MARK(d->ovbits, page);
+		if (pwrite_all(fd, d->ovbits, sizeof(d->ovbits), DOV_BITMAP) < 0 ||
+			fsync(fd) < 0) {
+			fprintf(stderr, "failed to write overlay bitmap (%s)\n", strerror(errno));
+			free(buff);
+			return -1;
+		}
+	}
+
+	/* 3rd: the journal is no longer needed */
+	unlink(d->journal);
+	free(buff);
+
+	LOG((log_DRV,0,"drive #%d wrote back %d pages\n", unit, count));
+	memset(d->dirty, 0, sizeof(d->dirty));
+	d->ndirty = 0;
+
+	return count;
+}
+
+/**
+ * @brief write back the changed pages of all drives
+ *
+ * @result returns -1 if writing back failed for any drive, 0 otherwise
+ */
+static int drive_flush_units(void)
+{
+	int unit, rc = 0;
+
+	for (unit = 0; unit < DRIVE_MAX; unit++)
+		if (drive_flush(unit) < 0)
+			rc = -1;
+	return rc;
+}
+
+/**
+ * @brief write back the changed pages of all drives at exit
+ *
+ * Errors were reported by drive_flush(); exit() must not be called again.
+ */
+static void drive_flush_all(void)
+{
+	drive_flush_units();
+}
+
+/**
+ * @brief timer callback to periodically write back changed pages
+ *
+ * @param id timer id
+ * @param arg unused
+ */
+static void drive_flush_timer(timer_id_t id, int arg)
+{
+	if (drive_flush_units() < 0)
+		fatal(1, "failed to write back changed sectors\n");
+	if (timer_reschedule(id, TIME_S(write_back), arg) < 0)
+		timer_insert(TIME_S(write_back), drive_flush_timer, arg, "drive flush");
+}
+
+/**
+ * @brief start writing back the changes to a drive's image
+ *
+ * This is called for every image loaded while -wb is in effect, so the
+ * order of -wb and the image names on the command line does not matter.
+ * Only uncompressed images without an overlay are written back.
+ *
+ * @param unit unit number
+ * @param path path name of the image
+ */
+static void drive_write_back_open(int unit, const char *path)
+{
+	drive_t *d = &drive[unit];
+	int fd;
+
+	if (!d->image || d->wbfd >= 0 || d->ovfd >= 0)
+		return;
+	if (!d->journal) {
+		printf("changes to compressed image %s are not written back (use -ov=file)\n",
+			path);
+		return;
+	}
+	fd = open(path, O_RDWR);
+	if (fd < 0)
+		fatal(1, "failed to open(%s) for writing back (%s)\n",
+			path, strerror(errno));
+	d->wbfd = fd;
+}
+
 /**
  * @brief print usage info for the drive switches
  *
@@ -1675,6 +2763,12 @@ static void sector_mark_0(int id, int arg)
 int drive_usage(int argc, char **argv)
 {
 	printf("-dr		dump raw drive 0 image to 'dump.raw' at exit\n");
+	printf("-wb[=n]		write changes back to .dsk images (every n seconds; default %d)\n",
+		WRITE_BACK_DEFAULT);
+	printf("-zc=dir		cache decompressed images in directory dir\n");
+	printf("-ov=file	keep changes to the next image in the overlay file\n");
+	printf("-sc=n		cache up to n expanded sectors per drive (default %d)\n",
+		BITS_CACHE_DEFAULT);
 	return 0;
 }
 
@@ -1688,16 +2782,13 @@ int drive_args(const char *arg)
 {
 	const char *basename;
 	int unit;
-	int hdr, c, h, s, chs;
 	drive_t *d;
 	int zcat;
-	FILE *fp;
-	size_t size;		/* size in sectors */
-	size_t done;		/* read loops */
-	size_t csize;		/* size of cooked image */
-	uint8_t *image;		/* file image (either cooked, or compressed) */
-	sector_t *cooked;	/* cooked sector data */
-	uint8_t *ip, *cp;
+	int fd;
+	struct stat st;
+	const char *digest = NULL;
+	void *map;
+	sector_t *image;
 	char *p;
 
 	/* dump raw image at exit? */
@@ -1706,6 +2797,42 @@ int drive_args(const char *arg)
 		return 0;
 	}
 
+	/* write back changes to uncompressed images? */
+	if (!strncmp(arg, "-wb", 3) && (!arg[3] || '=' == arg[3])) {
+		write_back = arg[3] ? strtol(arg + 4, NULL, 0) : WRITE_BACK_DEFAULT;
+		if (write_back > 0 && !write_back_timer) {
+			/* the timer picks up a changed interval when it is rescheduled */
+			timer_insert(TIME_S(write_back), drive_flush_timer, 0, "drive flush");
+			write_back_timer = 1;
+		}
+		/* images loaded before the switch */
+		for (unit = 0; unit < DRIVE_MAX; unit++)
+			if (drive[unit].path)
+				drive_write_back_open(unit, drive[unit].path);
+		return 0;
+	}
+
+	/* cache directory for decompressed images */
+	if (!strncmp(arg, "-zc=", 4)) {
+		zcache_dir = arg + 4;
+		return 0;
+	}
+
+	/* overlay for the next image */
+	if (!strncmp(arg, "-ov=", 4)) {
+		overlay_next = arg + 4;
+		return 0;
+	}
+
+	/* size of the expanded sector cache */
+	if (!strncmp(arg, "-sc=", 4)) {
+		int val = strtol(arg + 4, NULL, 0);
+		if (val < 2)
+			fatal(1, "Invalid sector cache size: %d\n", val);
+		bits_cache_size = val;
+		return 0;
+	}
+
 	/* don't care about other switches */
 	if (arg[0] == '-' || arg[0] == '+')
 		return -1;
@@ -1726,6 +2853,25 @@ int drive_args(const char *arg)
 	if (!p)
 		return -1;
 
+	/* an overlay names its base image */
+	if (!strcmp(p, ".dov") || !strcmp(p, ".DOV")) {
+		dov_header_t hdr;
+		int rc;
+
+		fd = open(arg, O_RDONLY);
+		if (fd < 0)
+			fatal(1, "failed to open(%s) (%s)\n",
+				arg, strerror(errno));
+		if (drive_overlay_header(fd, &hdr) < 0)
+			fatal(1, "%s is not a valid overlay for this drive\n", arg);
+		close(fd);
+		LOG((log_DRV,0,"loading overlay %s for %s\n", arg, hdr.base));
+		overlay_next = arg;
+		rc = drive_args(hdr.base);
+		overlay_next = NULL;
+		return rc;
+	}
+
 	/* check for .Z extension */
 	if (!strcmp(p, ".z") || !strcmp(p, ".Z") ||
 		!strcmp(p, ".gz") || !strcmp(p, ".GZ")) {
@@ -1752,97 +2898,113 @@ int drive_args(const char *arg)
 
 	snprintf(d->basename, sizeof(d->basename), "%s", basename);
 
-	fp = fopen(arg, "rb");
-	if (!fp)
-		fatal(1, "failed to fopen(%s,\"rb\") (%s)\n",
+	/* the image is opened for writing back by drive_write_back_open() */
+	fd = open(arg, O_RDONLY);
+	if (fd < 0)
+		fatal(1, "failed to open(%s) (%s)\n",
+			arg, strerror(errno));
+	if (fstat(fd, &st) < 0)
+		fatal(1, "failed to fstat(%s) (%s)\n",
 			arg, strerror(errno));
 
-	/* size in sectors */
-	size = DRIVE_CYLINDERS * DRIVE_HEADS * DRIVE_SPT;
-
-	csize = size * sizeof(sector_t);
-	image = (uint8_t *)malloc(csize + 1);
-	if (!image)
-		fatal(1, "failed to malloc(%d) bytes\n", csize);
-	ip = (uint8_t *)image;
-	for (done = 0; done < size * sizeof(sector_t); /* */) {
-		int got = fread(ip + done, 1, size * sizeof(sector_t) - done, fp);
-		if (got < 0) {
-			LOG((0,0,"fread() returned error (%s)\n",
-				strerror(errno)));
-			break;
-		}
-		if (got == 0)
-			break;
-		done += got;
-	}
-	fclose(fp);
-
-	LOG((log_DRV,0, "got %d (%#x) bytes\n", done, done));
-
-	cooked = (sector_t *)malloc(csize);
-	if (!cooked)
-		fatal(1, "failed to malloc(%d) bytes\n", csize);
-	cp = (uint8_t *)cooked;
+	LOG((log_DRV,0, "got %d (%#x) bytes\n", st.st_size, st.st_size));
 
 	if (zcat) {
-		size_t skip;
-		int type = z_header(ip, done, &skip);
-
-		switch (type) {
-		case 0:
-			LOG((log_MISC,0, "compression type unknown, skip:%d\n", skip));
-			csize = gz_copy(cp, csize, ip, done);
-			break;
-		case 1:
-			LOG((log_MISC,0, "compression type compress (LZW), skip:%d\n", skip));
-			csize = z_copy(cp, csize, ip + skip, done - skip);
-			break;
-		case 2:
-			LOG((log_MISC,0, "compression type gzip, skip:%d\n", skip));
-			csize = gz_copy(cp, csize, ip, done);
-			break;
+		/* map the compressed file; it is decoded by a thread */
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (MAP_FAILED == map)
+			fatal(1, "failed to mmap(%s) (%s)\n",
+				arg, strerror(errno));
+		digest = zcache_dir ? md5_digest(map, st.st_size) : NULL;
+		image = digest ? drive_cache_load(digest) : NULL;
+		if (image) {
+			/* cache hit: no need to decompress */
+			munmap(map, st.st_size);
+			d->cooked = IMAGE_BYTES;
+		} else {
+			d->zs = z_open((uint8_t *)map, st.st_size);
+			if (!d->zs) {
+				LOG((log_DRV,0,"disk image %s is not compressed\n", arg));
+				munmap(map, st.st_size);
+				return -1;
+			}
+			if (z_size(d->zs) >= 0 && z_size(d->zs) != IMAGE_BYTES) {
+				LOG((log_DRV,0,"disk image %s size mismatch (%ld bytes)\n",
+					arg, (long)z_size(d->zs)));
+				z_close(d->zs);
+				d->zs = NULL;
+				munmap(map, st.st_size);
+				return -1;
+			}
+			image = (sector_t *)mmap(NULL, IMAGE_BYTES, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (MAP_FAILED == (void *)image)
+				fatal(1, "failed to mmap(%d) bytes (%s)\n",
+					IMAGE_BYTES, strerror(errno));
+			d->map = map;
+			d->mapsize = st.st_size;
+			d->cooked = 0;
 		}
 	} else {
-		memcpy(cp, ip, done);
-		csize = done;
-	}
-	free(image);
-	image = NULL;
-	ip = NULL;
-
-	if (csize != size * sizeof(sector_t)) {
-		LOG((log_DRV,0,"disk image %s size mismatch (%d bytes)\n", arg, csize));
-		free(cooked);
-		return -1;
-	}
-
-	/* reset cylinder, head, sector counters */
-	c = h = s = 0;
-
-	/* check image sectors for sanity */
-	for (done = 0; done < size; done++) {
-		/* copy the available records in their place */
-
-		/* verify the chs with the header and log any mismatches */
-		hdr = cooked->header[2] + 256 * cooked->header[3];
-		chs = (s << 12) | (c << 3) | (h << 2) | (unit << 1);
-		if (chs != hdr) {
-			LOG((log_DRV,0,"WARNING: header mismatch C/H/S: %3d/%d/%2d chs:%06o hdr:%06o\n",
-				c, h, s, chs, hdr));
+		if ((size_t)st.st_size < IMAGE_BYTES) {
+			LOG((log_DRV,0,"disk image %s size mismatch (%d bytes)\n",
+				arg, st.st_size));
+			close(fd);
+			return -1;
 		}
-		if (++s == DRIVE_SPT) {
-			s = 0;
-			if (++h == DRIVE_HEADS) {
-				h = 0;
-				c++;
-			}
+		/* a journal left over by a crash is replayed in any case */
+		d->journal = (char *)malloc(strlen(arg) + 9);
+		if (!d->journal)
+			fatal(1, "failed to malloc(%d) bytes\n", strlen(arg) + 9);
+		sprintf(d->journal, "%s.journal", arg);
+		if (0 == access(d->journal, F_OK)) {
+			int jfd = open(arg, O_RDWR);
+			if (jfd < 0)
+				fatal(1, "refusing to load %s: journal %s can not be replayed (%s)\n",
+					arg, d->journal, strerror(errno));
+			drive_journal_replay(jfd, d->journal, 0);
+			close(jfd);
 		}
-		cooked++;
+		/* map the image itself; changes are private until written back */
+		image = (sector_t *)mmap(NULL, IMAGE_BYTES, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE, fd, 0);
+		if (MAP_FAILED == (void *)image)
+			fatal(1, "failed to mmap(%s) (%s)\n",
+				arg, strerror(errno));
+		close(fd);
+		d->cooked = IMAGE_BYTES;
 	}
 
 	/* set drive image */
-	d->image = (sector_t *)cp;
+	d->image = image;
+
+	/* cache miss: store the image while it is decoded */
+	if (digest && d->zs)
+		drive_cache_create(unit, digest);
+
+	/* check the available image sectors for sanity */
+	drive_check_headers(unit, 0, d->cooked / sizeof(sector_t));
+
+	/* keep changes in an overlay? */
+	if (overlay_next) {
+		int fail;
+		drive_overlay_open(unit, overlay_next, arg);
+		if (drive_overlay_apply(unit, 0, d->cooked / sizeof(sector_t), &fail) < 0)
+			fatal(1, "failed to pread() overlay page #%d (%s)\n",
+				fail, strerror(errno));
+		overlay_next = NULL;
+	}
+
+	/* decode a compressed image while the emulation starts */
+	if (d->zs)
+		drive_decoder_start(unit);
+
+	d->path = strdup(arg);
+	if (!d->path)
+		fatal(1, "failed to strdup(%s)\n", arg);
+	if (write_back >= 0)
+		drive_write_back_open(unit, d->path);
 
 	LOG((log_DRV,0,"drive #%d successfully created image for %s\n", unit, arg));
 
@@ -1877,6 +3039,10 @@ static void drive_dump(void)
 	if (!drive[0].image)
 		return;
 
+	/* decode the rest of a compressed image */
+	if (drive_decode_wait(0, IMAGE_BYTES) < 0)
+		return;
+
 	fp = fopen(filename, "wb");
 	if (!fp)
 		fatal(1,"failed to fopen() %s\n", filename);
@@ -1896,6 +3062,10 @@ int drive_init(void)
 	int i;
 
 	atexit(drive_dump);
+	atexit(drive_flush_all);
+	atexit(drive_decode_all);
+
+	drive_lut_init();
 
 	if (sizeof(sector_t) != 267 * 2)
 		fatal(1, "sizeof(sector_t) is not %d (%d)\n",
@@ -1926,6 +3096,10 @@ int drive_init(void)
 		d->wrlast = -1;
 		d->rdfirst = -1;
 		d->rdlast = -1;
+
+		/* no image to write back to */
+		d->wbfd = -1;
+		d->ovfd = -1;
 	}
 
 	timer_id = timer_insert(drive[0].sector_time - SECTOR_MARK_PULSE_PRE,
@@ -450,7 +450,7 @@ uint32_t f9401_7(uint32_t crc, uint32_t data)
  * This is probably lacking the updates to one or more of
  * the status flip flops.
  */
-static void rx_duckbreath(int id, int arg)
+static void rx_duckbreath(timer_id_t id, int arg)
 {
 	uint32_t data;
 
@@ -485,10 +485,10 @@ static void rx_duckbreath(int id, int arg)
 		PUT_ETH_IGONE(eth.status, 1);
 		ether_show_indicators(1);
 
-		timer_insert(TIME_S(duckbreath_sec), rx_duckbreath, 0, "duckbreath");
+		timer_reschedule(id, TIME_S(duckbreath_sec), 0);
 	} else {
 		/* 5.44us per word (?) */
-		timer_insert(TIME_US(5.44), rx_duckbreath, arg, "duckbreath");
+		timer_reschedule(id, TIME_US(5.44), arg);
 	}
 
 	eth_wakeup();
@@ -500,7 +500,7 @@ static void rx_duckbreath(int id, int arg)
  * @param id timer id
  * @param arg word count if >= 0, -1 if CRC is to be transmitted (last word)
  */
-static void tx_packet(int id, int arg)
+static void tx_packet(timer_id_t id, int arg)
 {
 	uint32_t data;
 
@@ -531,13 +531,13 @@ static void tx_packet(int id, int arg)
 		/* clear the OBUSY and WLF flip flops */
 		PUT_ETH_OBUSY(eth.status, 0);
 		PUT_ETH_WLF(eth.status, 0);
-		eth.tx_id = timer_insert(TIME_US(5.44), tx_packet, -1, "tx packet CRC");
+		eth.tx_id = timer_reschedule(id, TIME_US(5.44), -1);
 		eth_wakeup();
 		return;
 	}
 
 	/* next word */
-	eth.tx_id = timer_insert(TIME_US(5.44), tx_packet, arg + 1, "tx packet");
+	eth.tx_id = timer_reschedule(id, TIME_US(5.44), arg + 1);
 	eth_wakeup();
 }
 
@@ -462,7 +462,7 @@ int mng_write_FRAM(mng_t *mng)
 		return rc;
 	if (0 != (rc = xng_write_string(mng,"FRAM")))		/* frame header */
 		return rc;
-	if (0 != (rc = xng_write_byte(mng,1)))			/* framing mode: 1 */
+	if (0 != (rc = xng_write_byte(mng,mng->framing)))	/* framing mode */
 		return rc;
 	/* subframe name: omitted */
 	if (w_any) {
@@ -1275,8 +1275,8 @@ int mng_finish_png(mng_t *mng)
 	if (NULL == mng->png)
 		return rc;
 
-	/* write a FRAM chunk */
-	if (0 != (rc = mng_write_FRAM(mng))) {
+	/* write a FRAM chunk, unless the png is a layer of a started frame */
+	if (!mng->layered && 0 != (rc = mng_write_FRAM(mng))) {
 		goto bailout;
 	}
 	/* need to write a DEFI chunk? */
@@ -1314,7 +1314,8 @@ int mng_finish_png(mng_t *mng)
 	 *	observer (with an inhumanly fast visual system) as a sequence
 	 *	of still pictures.
 	 */
-	mng->fcount++;
+	if (!mng->layered)
+		mng->fcount++;
 	mng->lcount++;
 
 bailout:
@@ -1775,6 +1776,9 @@ mng_t *mng_create(int w, int h, int ticks,
 	/* default interframe delay: 1 tick */
 	mng->ifdelay = mng->ifdelay_default = 1;
 
+	/* default framing mode: every image is a frame */
+	mng->framing = 1;
+
 	/* default timeout: 0x7fffffff = infinite */
 	mng->timeout = mng->timeout_default = 0x7fffffff;
 
@@ -1919,6 +1923,10 @@ png_t *mng_append_png(mng_t *mng, int x, int y, int w, int h, int color, int dep
 		return NULL;
 	}
 
+	/* the new png is a frame of its own */
+	mng->framing = 1;
+	mng->layered = 0;
+
 	/* set xloc, yloc and clipping boundaries */
 	mng->xloc = x;
 	mng->yloc = y;
@@ -1932,5 +1940,98 @@ png_t *mng_append_png(mng_t *mng, int x, int y, int w, int h, int color, int dep
 	mng->png = png_create(w, h, color, depth,
 		mng->x.cookie, mng->x.output);
 
+	/* use a medium compression level to speed things up */
+	if (NULL != mng->png)
+		mng->png->level = 5;
+
 	return mng->png;
 }
+
+/**
+ * @brief start a frame of one or more images in the MNG stream
+ *
+ * Writes a FRAM chunk with framing mode 2. The images appended with
+ * mng_append_image() until the next frame are its layers; they are
+ * shown together, and the delay applies after the last one of them.
+ *
+ * @param mng pointer to a struct mng_t
+ * @param delay number of ticks to show the frame
+ * @result returns 0 on success, -1 on error
+ */
+int mng_start_frame(mng_t *mng, int delay)
+{
+	int rc;
+
+	if (NULL == mng || NULL == mng->x.output) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (0 != (rc = mng_write_mhdr(mng))) {
+		return rc;
+	}
+
+	/* finish previous png, if any */
+	if (0 != (rc = mng_finish_png(mng))) {
+		return rc;
+	}
+
+	mng->framing = 2;
+	mng->ifdelay = delay;
+	if (0 != (rc = mng_write_FRAM(mng))) {
+		return rc;
+	}
+	mng->layered = 1;
+	mng->fcount++;
+	return 0;
+}
+
+/**
+ * @brief write a PNG image created with png_create() to the MNG stream
+ *
+ * The image is written at once, so its data can be prepared (and
+ * compressed with png_compress()) before, e.g. on another thread.
+ *
+ * @param mng pointer to a struct mng_t
+ * @param png pointer to a struct png_t; it is finished and freed
+ * @param x x location of the PNG in the frame
+ * @param y y location of the PNG in the frame
+ * @result returns 0 on success, -1 on error
+ */
+int mng_append_image(mng_t *mng, png_t *png, int x, int y)
+{
+	int rc = -1;
+
+	if (NULL == mng || NULL == mng->x.output || NULL == png) {
+		errno = EINVAL;
+		goto bailout;
+	}
+
+	if (0 != (rc = mng_write_mhdr(mng))) {
+		goto bailout;
+	}
+
+	if (0 != (rc = mng_finish_png(mng))) {
+		goto bailout;
+	}
+
+	/* set xloc, yloc and clipping boundaries */
+	mng->xloc = x;
+	mng->yloc = y;
+
+	mng->l_cb = x;
+	mng->r_cb = x + png->w;
+	mng->t_cb = y;
+	mng->b_cb = y + png->h;
+
+	/* write the png to the mng's output */
+	png->x.cookie = mng->x.cookie;
+	png->x.output = mng->x.output;
+	mng->png = png;
+
+	return mng_finish_png(mng);
+
+bailout:
+	png_discard(png);
+	return rc;
+}
@@ -22,6 +22,9 @@
  *****************************************************************************/
 
 #include "png.h"
+#if	defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /** @brief check if standalone logging */
 #if !defined(LOG)
@@ -1331,6 +1334,211 @@ int png_read_IEND(png_t *png, uint32_t size)
 	return 0;
 }
 
+/**
+ * @brief filter a row of image data
+ *
+ * @param dst buffer for the filtered bytes
+ * @param cur pointer to the row's bytes (without the filter type)
+ * @param up pointer to the previous row's bytes, or NULL for the first row
+ * @param n number of bytes in the row
+ * @param bpp bytes per complete pixel (at least 1)
+ * @param type filter type (0 none, 1 sub, 2 up, 3 average, 4 Paeth)
+ * @result sum of the absolute values of the filtered bytes taken as signed
+ */
+static uint32_t png_filter(uint8_t *dst, const uint8_t *cur, const uint8_t *up,
+	uint32_t n, uint32_t bpp, int type)
+{
+	uint32_t x, sum = 0;
+	int a, b, c, p, pa, pb, pc;
+
+	for (x = 0; x < n; x++) {
+		a = x >= bpp ? cur[x - bpp] : 0;
+		b = NULL != up ? up[x] : 0;
+		c = NULL != up && x >= bpp ? up[x - bpp] : 0;
+		switch (type) {
+		case 0:
+			dst[x] = cur[x];
+			break;
+		case 1:
+			dst[x] = cur[x] - a;
+			break;
+		case 2:
+			dst[x] = cur[x] - b;
+			break;
+		case 3:
+			dst[x] = cur[x] - (a + b) / 2;
+			break;
+		default:
+			p = a + b - c;
+			pa = p > a ? p - a : a - p;
+			pb = p > b ? p - b : b - p;
+			pc = p > c ? p - c : c - p;
+			if (pa <= pb && pa <= pc)
+				dst[x] = cur[x] - a;
+			else if (pb <= pc)
+				dst[x] = cur[x] - b;
+			else
+				dst[x] = cur[x] - c;
+			break;
+		}
+		sum += dst[x] < 128 ? dst[x] : 256 - dst[x];
+	}
+	return sum;
+}
+
+/**
+ * @brief filter and deflate the image data of a PNG image
+ *
+ * Each row is filtered and fed to the deflate stream on its own. For
+ * images with 8 or more bits per pixel and no palette, the filter with
+ * the smallest sum of absolute differences is chosen per row; others
+ * are not filtered, as their bytes do not hold single samples.
+ * The compressed data is passed to emit() in pieces of PNG_IDAT_SIZE
+ * bytes; only the last one can be smaller.
+ *
+ * @param png pointer to a png_t context
+ * @param level zlib compression level (0 to 9)
+ * @param emit function to take a piece of compressed data
+ * @result returns 0 on success, -1 on error
+ */
+static int png_deflate(png_t *png, int level,
+	int (*emit)(png_t *png, uint8_t *data, uint32_t size))
+{
+	z_stream zs;
+	uint8_t *out = NULL;
+	uint8_t *row = NULL;
+	uint8_t *best, *trial, *swap;
+	const uint8_t *cur, *up;
+	uint32_t y, n, bpp, sum, min;
+	int type, flush, zrc, rc = -1;
+
+	memset(&zs, 0, sizeof(zs));
+	if (Z_OK != (zrc = deflateInit(&zs, level))) {
+		LOG((log_MISC,1,"deflateInit(%p,%d) call failed (%d)\n",
+			&zs, level, zrc));
+		return -1;
+	}
+
+	out = malloc(PNG_IDAT_SIZE);
+	row = malloc(2 * png->stride);
+	if (NULL == out || NULL == row) {
+		LOG((log_MISC,1,"malloc(%d) call failed (%s)\n",
+			PNG_IDAT_SIZE + 2 * png->stride, strerror(errno)));
+		goto bailout;
+	}
+	best = row;
+	trial = row + png->stride;
+	n = png->stride - 1;
+	bpp = png->bpp < 8 ? 1 : png->bpp / 8;
+
+	zs.next_out = out;
+	zs.avail_out = PNG_IDAT_SIZE;
+	for (y = 0; y <= png->h; y++) {
+		if (y < png->h) {
+			cur = png->img + y * png->stride + 1;
+			up = y > 0 ? cur - png->stride : NULL;
+			best[0] = 0;
+			min = png_filter(best + 1, cur, up, n, bpp, 0);
+			if (COLOR_PALETTE != png->color && png->bpp >= 8) {
+				for (type = 1; type < 5 && min > 0; type++) {
+					sum = png_filter(trial + 1, cur, up, n, bpp, type);
+					if (sum >= min)
+						continue;
+					trial[0] = type;
+					min = sum;
+					swap = best;
+					best = trial;
+					trial = swap;
+				}
+			}
+			zs.next_in = best;
+			zs.avail_in = png->stride;
+			flush = Z_NO_FLUSH;
+		} else {
+			zs.next_in = NULL;
+			zs.avail_in = 0;
+			flush = Z_FINISH;
+		}
+		for (;;) {
+			zrc = deflate(&zs, flush);
+			if (Z_STREAM_ERROR == zrc) {
+				LOG((log_MISC,1,"deflate(%p,%d) call failed (%d)\n",
+					&zs, flush, zrc));
+				goto bailout;
+			}
+			/* output space left: the row is consumed, or the stream ended */
+			if (zs.avail_out > 0)
+				break;
+			if (0 != (*emit)(png, out, PNG_IDAT_SIZE))
+				goto bailout;
+			zs.next_out = out;
+			zs.avail_out = PNG_IDAT_SIZE;
+		}
+	}
+	if (zs.avail_out < PNG_IDAT_SIZE &&
+		0 != (*emit)(png, out, PNG_IDAT_SIZE - zs.avail_out))
+		goto bailout;
+	rc = 0;
+
+bailout:
+	deflateEnd(&zs);
+	if (NULL != row)
+		free(row);
+	if (NULL != out)
+		free(out);
+	return rc;
+}
+
+/**
+ * @brief append a piece of compressed data to the image's idat buffer
+ *
+ * @param png pointer to a png_t context
+ * @param data pointer to the compressed data
+ * @param size number of bytes
+ * @result returns 0 on success, -1 on error
+ */
+static int png_append_idat(png_t *png, uint8_t *data, uint32_t size)
+{
+	uint8_t *idat = realloc(png->idat, png->isize + size);
+
+	if (NULL == idat) {
+		LOG((log_MISC,1,"realloc(%p,%d) call failed (%s)\n",
+			png->idat, png->isize + size, strerror(errno)));
+		return -1;
+	}
+	memcpy(idat + png->isize, data, size);
+	png->idat = idat;
+	png->isize += size;
+	return 0;
+}
+
+/**
+ * @brief write the IDAT chunks of a PNG image
+ *
+ * Writes the data from png_compress(), if any, or else filters and
+ * compresses the image at png->level while writing it.
+ *
+ * @param png pointer to a png_t context
+ * @result returns 0 on success, -1 on error
+ */
+static int png_write_image(png_t *png)
+{
+	size_t offs;
+	uint32_t size;
+	int rc;
+
+	if (NULL == png->idat)
+		return png_deflate(png, png->level, png_write_IDAT);
+
+	for (offs = 0; offs < png->isize; offs += size) {
+		size = png->isize - offs < PNG_IDAT_SIZE ?
+			png->isize - offs : PNG_IDAT_SIZE;
+		if (0 != (rc = png_write_IDAT(png, png->idat + offs, size)))
+			return rc;
+	}
+	return 0;
+}
+
 /**
  * @brief finish a PNG image (read or created) and write to output
  *
@@ -1339,7 +1547,6 @@ int png_read_IEND(png_t *png, uint32_t size)
  */
 int png_finish(png_t *png)
 {
-	uLong gzsize;
 	int rc = -1;
 
 	if (NULL == png) {
@@ -1392,23 +1599,7 @@ int png_finish(png_t *png)
 			goto bailout;
 	}
 
-	gzsize = 16 + png->size + png->size / 4;
-	png->idat = malloc(gzsize);
-	if (NULL == png->idat) {
-		LOG((log_MISC,1,"malloc(%d) call failed (%s)\n",
-			gzsize, strerror(errno)));
-		rc = -1;
-		goto bailout;
-	}
-
-	if (Z_OK != (rc = compress2(png->idat, &gzsize, png->img, png->size, 9))) {
-		LOG((log_MISC,1,"compress2(%p,%#x,%#p,%#x,%d) call failed (%d)\n",
-			png->idat, gzsize,
-			png->img, png->size, 9, rc));
-		goto bailout;
-	}
-	png->isize = gzsize;
-	if (0 != (rc = png_write_IDAT(png,png->idat,png->isize)))
+	if (0 != (rc = png_write_image(png)))
 		goto bailout;
 	if (0 != (rc = png_write_IEND(png)))
 		goto bailout;
@@ -1429,15 +1620,49 @@ bailout:
 	return rc;
 }
 
+/**
+ * @brief compress the image data of a PNG image
+ *
+ * The compressed data is kept in the context until the image is
+ * finished, so this can be done on another thread than the writing.
+ *
+ * @param png pointer to a png_t context
+ * @param level zlib compression level (0 to 9)
+ * @result returns 0 on success, -1 on error
+ */
+int png_compress(png_t *png, int level)
+{
+	if (NULL == png || NULL == png->img) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (NULL != png->idat)
+		free(png->idat);
+	png->idat = NULL;
+	png->isize = 0;
+	png->level = level;
+	if (0 != png_deflate(png, level, png_append_idat)) {
+		if (NULL != png->idat)
+			free(png->idat);
+		png->idat = NULL;
+		png->isize = 0;
+		return -1;
+	}
+	return 0;
+}
+
 /**
  * @brief finish a PNG image to be written to a MNG stream
  *
+ * If png_compress() was not called for the image, it is compressed
+ * at png->level while it is written.
+ *
  * @param png pointer to a png_t context
  * @result returns 0 on success, -1 on error
  */
 int png_finish_mng(png_t *png)
 {
-	uLong gzsize;
 	int rc = -1;
 
 	if (NULL == png) {
@@ -1467,24 +1692,7 @@ int png_finish_mng(png_t *png)
 			goto bailout;
 	}
 
-	gzsize = 16 + png->size + png->size / 4;
-	png->idat = malloc(gzsize);
-	if (NULL == png->idat) {
-		LOG((log_MISC,1,"malloc(%d) call failed (%s)\n",
-			gzsize, strerror(errno)));
-		rc = -1;
-		goto bailout;
-	}
-
-	/* use a medium compression level to speed things up */
-	if (Z_OK != (rc = compress2(png->idat, &gzsize, png->img, png->size, 5))) {
-		LOG((log_MISC,1,"compress2(%p,%#x,%#p,%#x,%d) call failed (%d)\n",
-			png->idat, gzsize,
-			png->img, png->size, 5, rc));
-		goto bailout;
-	}
-	png->isize = gzsize;
-	if (0 != (rc = png_write_IDAT(png,png->idat,png->isize)))
+	if (0 != (rc = png_write_image(png)))
 		goto bailout;
 	if (0 != (rc = png_write_IEND(png)))
 		goto bailout;
@@ -2048,6 +2256,9 @@ png_t *png_create(int w, int h, int color, int depth,
 	png->color = color;
 	png->depth = depth;
 
+	/* default: best compression */
+	png->level = 9;
+
 	/* default sRGB chunk (?) */
 	png->srgb_size = sizeof(png->srgb);
 	/*
@@ -2247,6 +2458,28 @@ int png_set_palette(png_t *png, int idx, int color)
 	return 0;
 }
 
+/**
+ * @brief get the background color of a png_t context
+ *
+ * @param png pointer to a png_t context
+ * @result returns the color value of the bKGD chunk
+ */
+static int png_bkgd(png_t *png)
+{
+	switch (png->bkgd_size) {
+	case 1:
+		return png->bkgd[0];
+	case 2:
+		return (png->bkgd[0] << 8) | png->bkgd[1];
+	case 3:
+		return (png->bkgd[0] << 16) | (png->bkgd[1] << 8) | png->bkgd[2];
+	case 6:
+		return (png->bkgd[0] << 16) | (png->bkgd[2] << 8) | png->bkgd[4];
+	default:
+		return png->bkgd[0];
+	}
+}
+
 /**
  * @brief set a pixel in a png_t context
  *
@@ -2274,24 +2507,8 @@ int png_put_pixel(png_t *png, int x, int y, int color, int alpha)
 		return 0;
 	}
 
-	if (-1 == color) {
-		switch (png->bkgd_size) {
-		case 1:
-			color = png->bkgd[0];
-			break;
-		case 2:
-			color = (png->bkgd[0] << 8) | png->bkgd[1];
-			break;
-		case 3:
-			color = (png->bkgd[0] << 16) | (png->bkgd[1] << 8) | png->bkgd[2];
-			break;
-		case 6:
-			color = (png->bkgd[0] << 16) | (png->bkgd[2] << 8) | png->bkgd[4];
-			break;
-		default:
-			color = png->bkgd[0];
-		}
-	}
+	if (-1 == color)
+		color = png_bkgd(png);
 
 	switch (png->color) {
 	case COLOR_GRAYSCALE:
@@ -2450,37 +2667,22 @@ int png_get_pixel(png_t *png, int x, int y, int *color, int *alpha)
 		return 0;
 	}
 
-	switch (png->bkgd_size) {
-	case 1:
-		bkgd = png->bkgd[0];
-		break;
-	case 2:
-		bkgd = (png->bkgd[0] << 8) | png->bkgd[1];
-		break;
-	case 3:
-		bkgd = (png->bkgd[0] << 16) | (png->bkgd[1] << 8) | png->bkgd[2];
-		break;
-	case 6:
-		bkgd = (png->bkgd[0] << 16) | (png->bkgd[2] << 8) | png->bkgd[4];
-		break;
-	default:
-		bkgd = png->bkgd[0];
-	}
+	bkgd = png_bkgd(png);
 
 	switch (png->color) {
 	case COLOR_GRAYSCALE:
 		switch (png->depth) {
 		case 1:
 			offs = 1 + y * png->stride + x / 8;
-			*color = (png->img[offs] >> (x % 8)) & 1;
+			*color = (png->img[offs] >> (7 - x % 8)) & 1;
 			break;
 		case 2:
 			offs = 1 + y * png->stride + x / 4;
-			*color = (png->img[offs] >> (2 * (x % 4))) & 3;
+			*color = (png->img[offs] >> (6 - 2 * (x % 4))) & 3;
 			break;
 		case 4:
 			offs = 1 + y * png->stride + x / 2;
-			*color = (png->img[offs] >> (4 * (x % 2))) & 15;
+			*color = (png->img[offs] >> (4 - 4 * (x % 2))) & 15;
 			break;
 		case 8:
 			offs = 1 + y * png->stride + x;
@@ -2514,15 +2716,15 @@ int png_get_pixel(png_t *png, int x, int y, int *color, int *alpha)
 		switch (png->depth) {
 		case 1:
 			offs = 1 + y * png->stride + x / 8;
-			*color = (png->img[offs] >> (x % 8)) & 1;
+			*color = (png->img[offs] >> (7 - x % 8)) & 1;
 			break;
 		case 2:
 			offs = 1 + y * png->stride + x / 4;
-			*color = (png->img[offs] >> (2 * (x % 4))) & 3;
+			*color = (png->img[offs] >> (6 - 2 * (x % 4))) & 3;
 			break;
 		case 4:
 			offs = 1 + y * png->stride + x / 2;
-			*color = (png->img[offs] >> (4 * (x % 2))) & 15;
+			*color = (png->img[offs] >> (4 - 4 * (x % 2))) & 15;
 			break;
 		case 8:
 			offs = 1 + y * png->stride + x;
@@ -2576,6 +2778,499 @@ int png_get_pixel(png_t *png, int x, int y, int *color, int *alpha)
 	return 0;
 }
 
+/**
+ * @brief put a row of pixels into a png_t context
+ *
+ * Does the checks and the switch on the color format once per row,
+ * instead of once per pixel. Pixels outside the image are skipped.
+ *
+ * @param png pointer to a png_t context
+ * @param x x coordinate of the first pixel
+ * @param y y coordinate of the row (0 .. png->h - 1)
+ * @param w number of pixels
+ * @param color array of w color values (format depends on PNG color format; -1 is background color)
+ * @param alpha array of w alpha values (only used in color formats with alpha channel), or NULL
+ * @result returns 0 on success, -1 on error
+ */
+int png_put_row(png_t *png, int x, int y, int w, const int *color, const int *alpha)
+{
+	uint8_t *dst;
+	uint32_t offs, cmask;
+	int i, c, a, bkgd, shift;
+
+	if (NULL == png || NULL == png->img || NULL == color) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* clip to the image */
+	if (x < 0) {
+		color -= x;
+		if (NULL != alpha)
+			alpha -= x;
+		w += x;
+		x = 0;
+	}
+	if (x < (int)png->w && x + w > (int)png->w)
+		w = png->w - x;
+	if (y < 0 || (uint32_t)y >= png->h || x >= (int)png->w || w <= 0) {
+		LOG((log_MISC,5,"png_put_row(%p,%d,%d,%d,%p,%p) out of bounds\n",
+			png, x, y, w, color, alpha));
+		return 0;
+	}
+
+	bkgd = png_bkgd(png);
+	dst = png->img + 1 + y * png->stride;
+
+	switch (png->color) {
+	case COLOR_GRAYSCALE:
+	case COLOR_PALETTE:
+		switch (png->depth) {
+		case 1:
+		case 2:
+		case 4:
+			cmask = (1u << png->depth) - 1;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				offs = (x + i) * png->depth;
+				shift = 8 - png->depth - offs % 8;
+				dst[offs / 8] = (dst[offs / 8] & ~(cmask << shift)) |
+					((c & cmask) << shift);
+			}
+			break;
+		case 8:
+			dst += x;
+			for (i = 0; i < w; i++)
+				*dst++ = -1 == color[i] ? bkgd : color[i];
+			break;
+		case 16:
+			if (COLOR_GRAYSCALE != png->color)
+				break;
+			dst += x * 2;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				*dst++ = c >> 8;
+				*dst++ = c;
+			}
+			break;
+		}
+		break;
+	case COLOR_RGBTRIPLE:
+		switch (png->depth) {
+		case 8:
+			dst += x * 3;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				*dst++ = c >> 16;
+				*dst++ = c >> 8;
+				*dst++ = c;
+			}
+			break;
+		case 16:
+			dst += x * 6;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				*dst++ = c >> 16;
+				*dst++ = 0;
+				*dst++ = c >> 8;
+				*dst++ = 0;
+				*dst++ = c;
+				*dst++ = 0;
+			}
+			break;
+		}
+		break;
+	case COLOR_GRAYALPHA:
+		switch (png->depth) {
+		case 8:
+			dst += x * 2;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				a = NULL != alpha ? alpha[i] : 0;
+				*dst++ = c;
+				*dst++ = a;
+			}
+			break;
+		case 16:
+			dst += x * 4;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				a = NULL != alpha ? alpha[i] : 0;
+				*dst++ = c >> 8;
+				*dst++ = c;
+				*dst++ = a >> 8;
+				*dst++ = a;
+			}
+			break;
+		}
+		break;
+	case COLOR_RGBALPHA:
+		switch (png->depth) {
+		case 8:
+			dst += x * 4;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				a = NULL != alpha ? alpha[i] : 0;
+				*dst++ = c >> 16;
+				*dst++ = c >> 8;
+				*dst++ = c;
+				*dst++ = a;
+			}
+			break;
+		case 16:
+			dst += x * 8;
+			for (i = 0; i < w; i++) {
+				c = -1 == color[i] ? bkgd : color[i];
+				a = NULL != alpha ? alpha[i] : 0;
+				*dst++ = c >> 16;
+				*dst++ = 0;
+				*dst++ = c >> 8;
+				*dst++ = 0;
+				*dst++ = c;
+				*dst++ = 0;
+				*dst++ = a >> 8;
+				*dst++ = a;
+			}
+			break;
+		}
+		break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief get a row of pixels from a png_t context
+ *
+ * Does the checks and the switch on the color format once per row,
+ * instead of once per pixel. Pixels outside the image are left as is.
+ *
+ * @param png pointer to a png_t context
+ * @param x x coordinate of the first pixel
+ * @param y y coordinate of the row (0 .. png->h - 1)
+ * @param w number of pixels
+ * @param color array for w color values to return (-1 is background color)
+ * @param alpha array for w alpha values to return, or NULL
+ * @result returns 0 on success, -1 on error
+ */
+int png_get_row(png_t *png, int x, int y, int w, int *color, int *alpha)
+{
+	const uint8_t *src;
+	uint32_t offs, cmask;
+	int i, bkgd;
+
+	if (NULL == png || NULL == png->img || NULL == color) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* clip to the image */
+	if (x < 0) {
+		color -= x;
+		if (NULL != alpha)
+			alpha -= x;
+		w += x;
+		x = 0;
+	}
+	if (x < (int)png->w && x + w > (int)png->w)
+		w = png->w - x;
+	if (y < 0 || (uint32_t)y >= png->h || x >= (int)png->w || w <= 0) {
+		LOG((log_MISC,5,"png_get_row(%p,%d,%d,%d,%p,%p) out of bounds\n",
+			png, x, y, w, color, alpha));
+		return 0;
+	}
+
+	bkgd = png_bkgd(png);
+	src = png->img + 1 + y * png->stride;
+	if (NULL != alpha)
+		memset(alpha, 0, w * sizeof(*alpha));
+
+	switch (png->color) {
+	case COLOR_GRAYSCALE:
+	case COLOR_PALETTE:
+		switch (png->depth) {
+		case 1:
+		case 2:
+		case 4:
+			cmask = (1u << png->depth) - 1;
+			for (i = 0; i < w; i++) {
+				offs = (x + i) * png->depth;
+				color[i] = (src[offs / 8] >>
+					(8 - png->depth - offs % 8)) & cmask;
+			}
+			break;
+		case 8:
+			src += x;
+			for (i = 0; i < w; i++)
+				color[i] = *src++;
+			break;
+		case 16:
+			if (COLOR_GRAYSCALE != png->color) {
+				memset(color, 0, w * sizeof(*color));
+				break;
+			}
+			src += x * 2;
+			for (i = 0; i < w; i++, src += 2)
+				color[i] = (src[0] << 8) | src[1];
+			break;
+		}
+		break;
+	case COLOR_RGBTRIPLE:
+		switch (png->depth) {
+		case 8:
+			src += x * 3;
+			for (i = 0; i < w; i++, src += 3)
+				color[i] = (src[0] << 16) | (src[1] << 8) | src[2];
+			break;
+		case 16:
+			src += x * 6;
+			for (i = 0; i < w; i++, src += 6)
+				color[i] = (src[0] << 16) | (src[2] << 8) | src[4];
+			break;
+		}
+		break;
+	case COLOR_GRAYALPHA:
+		switch (png->depth) {
+		case 8:
+			src += x * 2;
+			for (i = 0; i < w; i++, src += 2) {
+				color[i] = src[0];
+				if (NULL != alpha)
+					alpha[i] = src[1];
+			}
+			break;
+		case 16:
+			src += x * 4;
+			for (i = 0; i < w; i++, src += 4) {
+				color[i] = (src[0] << 8) | src[1];
+				if (NULL != alpha)
+					alpha[i] = (src[2] << 8) | src[3];
+			}
+			break;
+		}
+		break;
+	case COLOR_RGBALPHA:
+		switch (png->depth) {
+		case 8:
+			src += x * 4;
+			for (i = 0; i < w; i++, src += 4) {
+				color[i] = (src[0] << 16) | (src[1] << 8) | src[2];
+				if (NULL != alpha)
+					alpha[i] = src[3];
+			}
+			break;
+		case 16:
+			src += x * 8;
+			for (i = 0; i < w; i++, src += 8) {
+				color[i] = (src[0] << 16) | (src[2] << 8) | src[4];
+				if (NULL != alpha)
+					alpha[i] = (src[6] << 8) | src[7];
+			}
+			break;
+		}
+		break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+
+	for (i = 0; i < w; i++)
+		if (bkgd == color[i])
+			color[i] = -1;
+
+	return 0;
+}
+
+/**
+ * @brief fetch a scanline of 1bpp source pixels
+ *
+ * The bits are stored MSB first, with the first pixel in bit 7 of dst[0];
+ * bits following the last pixel are undefined. Byte aligned spans are
+ * copied as bytes, or as byte swapped words if sxor is 1, other spans
+ * are shifted into place a byte at a time.
+ *
+ * @param dst destination for (w + 7) / 8 bytes
+ * @param src source memory
+ * @param soff source offset of the byte with the first pixel
+ * @param sbit bit number of the first pixel (0 is the MSB)
+ * @param w number of pixels
+ * @param sxor source offset XOR value (to address bytes of little endian words)
+ */
+static void png_fetch_1bpp(uint8_t *dst, const uint8_t *src,
+	uint32_t soff, int sbit, int w, int sxor)
+{
+	int i, n = (w + 7) / 8;
+	uint32_t lo;
+
+	if (0 == sbit && 0 == sxor) {
+		memcpy(dst, src + soff, n);
+		return;
+	}
+	if (0 == sbit) {
+		i = 0;
+		if (1 == sxor && 0 == (soff & 1)) {
+			for (; i + 1 < n; i += 2) {
+				dst[i+0] = src[soff + i + 1];
+				dst[i+1] = src[soff + i + 0];
+			}
+		}
+		for (; i < n; i++)
+			dst[i] = src[sxor ^ (soff + i)];
+		return;
+	}
+	for (i = 0; i < n; i++) {
+		/* the next byte is needed only if pixels are left in it */
+		lo = w - 8 * i > 8 - sbit ? src[sxor ^ (soff + i + 1)] : 0;
+		dst[i] = (src[sxor ^ (soff + i)] << sbit) | (lo >> (8 - sbit));
+	}
+}
+
+/**
+ * @brief expand 1bpp pixels to packed pixels of 1, 2, 4 or 8 bits
+ *
+ * For depth 1 the colors are applied to whole bytes. Otherwise a table
+ * with the packed bytes of all 16 combinations of 4 pixels is built,
+ * and for 8 bits per pixel 16 pixels at a time are expanded by SSE2,
+ * if available, comparing every byte lane against its bit mask.
+ *
+ * @param dst destination for (w + 7) / 8 * depth bytes
+ * @param bits source pixels from png_fetch_1bpp()
+ * @param w number of pixels
+ * @param depth bits per destination pixel
+ * @param colors array of integers with colors for source pixels
+ */
+static void png_expand_1bpp(uint8_t *dst, const uint8_t *bits, int w,
+	int depth, int colors[])
+{
+	uint8_t tab[16][4];
+	uint32_t acc, cmask = (1u << depth) - 1;
+	int c0 = colors[0] & cmask;
+	int c1 = colors[1] & cmask;
+	int i, k, p, n = (w + 7) / 8;
+	int nb = depth / 2;
+
+	if (1 == depth) {
+		c0 = -c0 & 0xff;
+		c1 = (-c1 & 0xff) ^ c0;
+		for (i = 0; i < n; i++)
+			dst[i] = c0 ^ (bits[i] & c1);
+		return;
+	}
+
+	i = 0;
+#if	defined(__SSE2__)
+	if (8 == depth) {
+		const __m128i m = _mm_set_epi8(
+			0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80,
+			0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80);
+		const __m128i bg = _mm_set1_epi8(c0);
+		const __m128i fg = _mm_set1_epi8(c0 ^ c1);
+		const uint64_t ones = 0x0101010101010101ull;
+
+		for (; i + 1 < n; i += 2, dst += 16) {
+			__m128i v = _mm_set_epi64x(ones * bits[i+1], ones * bits[i]);
+			_mm_storeu_si128((__m128i *)dst, _mm_xor_si128(bg,
+				_mm_and_si128(fg, _mm_cmpeq_epi8(_mm_and_si128(v, m), m))));
+		}
+	}
+#endif
+	for (k = 0; k < 16; k++) {
+		acc = 0;
+		for (p = 0; p < 4; p++)
+			acc = (acc << depth) | ((k >> (3 - p)) & 1 ? c1 : c0);
+		for (p = 0; p < nb; p++)
+			tab[k][p] = acc >> (8 * (nb - 1 - p));
+	}
+	for (; i < n; i++) {
+		memcpy(dst, tab[bits[i] >> 4], nb);
+		dst += nb;
+		memcpy(dst, tab[bits[i] & 15], nb);
+		dst += nb;
+	}
+}
+
+/**
+ * @brief copy a string of bits into a scanline at any bit offset
+ *
+ * @param dst pointer to the scanline
+ * @param dbit bit offset of the first bit in the scanline (0 is the MSB)
+ * @param src source bits, MSB first
+ * @param nbits number of bits to copy
+ */
+static void png_put_bits(uint8_t *dst, uint32_t dbit, const uint8_t *src,
+	uint32_t nbits)
+{
+	uint32_t i, n, len;
+	int shift = dbit & 7;
+	uint8_t mask, b;
+
+	dst += dbit / 8;
+	if (0 == shift) {
+		n = nbits / 8;
+		memcpy(dst, src, n);
+		if (nbits & 7) {
+			mask = 0xff << (8 - (nbits & 7));
+			dst[n] = (dst[n] & ~mask) | (src[n] & mask);
+		}
+		return;
+	}
+	for (i = 0; 8 * i < nbits; i++) {
+		len = nbits - 8 * i < 8 ? nbits - 8 * i : 8;
+		mask = 0xff << (8 - len);
+		b = src[i] & mask;
+		dst[i] = (dst[i] & ~(mask >> shift)) | (b >> shift);
+		if (len + shift > 8)
+			dst[i+1] = (dst[i+1] & ~(uint8_t)(mask << (8 - shift))) |
+				(uint8_t)(b << (8 - shift));
+	}
+}
+
+/**
+ * @brief bit block transfer from 1bpp source to 1, 2, 4 or 8bpp packed pixels
+ *
+ * Each scanline is fetched, expanded and stored in whole bytes,
+ * instead of one pixel at a time.
+ *
+ * @param png pointer to a png_t context
+ * @param dx destination x
+ * @param dy destination y
+ * @param sx source x
+ * @param sy source y
+ * @param w width (already clipped)
+ * @param h height (already clipped)
+ * @param src source memory
+ * @param stride source memory stride per scanline
+ * @param sxor source offset XOR value (to address bytes of little endian words)
+ * @param colors array of integers with colors for source pixels
+ * @result returns 0 on success, -1 on error
+ */
+static int png_blit_packed(png_t *png, int dx, int dy, int sx, int sy,
+	int w, int h, uint8_t *src, int stride, int sxor, int colors[])
+{
+	int y, n = (w + 7) / 8;
+	uint8_t *bits, *pix;
+
+	bits = malloc(n * (1 + png->depth));
+	if (NULL == bits) {
+		LOG((log_MISC,1,"malloc(%d) call failed (%s)\n",
+			n * (1 + png->depth), strerror(errno)));
+		return -1;
+	}
+	pix = bits + n;
+	for (y = 0; y < h; y++) {
+		png_fetch_1bpp(bits, src, (sy + y) * stride + sx / 8, sx & 7,
+			w, sxor);
+		png_expand_1bpp(pix, bits, w, png->depth, colors);
+		png_put_bits(png->img + 1 + (dy + y) * png->stride,
+			dx * png->depth, pix, w * png->depth);
+	}
+	free(bits);
+	return 0;
+}
+
 /**
  * @brief bit block transfer from 1bpp source
  *
@@ -2597,7 +3292,7 @@ int png_blit_1bpp(png_t *png, int dx, int dy, int sx, int sy,
 	int w, int h, uint8_t *src, int stride, int sxor,
 	int colors[], int alpha)
 {
-	int x, y, sbit, dbit;
+	int x, y, sbit;
 	uint32_t soff, doff, sacc, dacc, mask;
 
 	/* clipping to PNG dimensions */
@@ -2620,125 +3315,15 @@ int png_blit_1bpp(png_t *png, int dx, int dy, int sx, int sy,
 	if (w <= 0 || h <= 0)
 		return 0;
 
+	/* gray or palette pixels of up to 8 bits are stored a row at a time */
+	if ((COLOR_GRAYSCALE == png->color || COLOR_PALETTE == png->color) &&
+		png->depth <= 8)
+		return png_blit_packed(png, dx, dy, sx, sy, w, h,
+			src, stride, sxor, colors);
+
 	switch (png->color) {
 	case COLOR_GRAYSCALE:
 		switch (png->depth) {
-		case 1:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << sbit;
-				doff = 1 + (dy + y) * png->stride + dx / 8;
-				dbit = dx & 7;
-				dacc = png->img[doff];
-				mask = 0x80 >> dbit;
-				for (x = 0; x < w; x++) {
-					dacc = (dacc & ~mask) |
-						((colors[(sacc>>7)&1] << (7-dbit)) & mask);
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-					if (dbit == 7) {
-						dbit = 0;
-						png->img[doff++] = dacc;
-						dacc = png->img[doff];
-						mask = 0x80;
-					} else {
-						dbit++;
-						mask >>= 1;
-					}
-				}
-				png->img[doff] = dacc;
-			}
-			break;
-		case 2:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << (7 - sbit);
-				doff = 1 + (dy + y) * png->stride + dx / 4;
-				dbit = (dx & 3) << 1;
-				dacc = png->img[doff];
-				mask = 0xc0 >> dbit;
-				for (x = 0; x < w; x++) {
-					dacc = (dacc & ~mask) |
-						((colors[(sacc>>7)&1] << (6-dbit)) & mask);
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-					if (dbit == 6) {
-						dbit = 0;
-						png->img[doff++] = dacc;
-						dacc = png->img[doff];
-						mask = 0xc0;
-					} else {
-						dbit += 2;
-						mask >>= 2;
-					}
-				}
-				png->img[doff] = dacc;
-			}
-			break;
-		case 4:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << sbit;
-				doff = 1 + (dy + y) * png->stride + dx / 2;
-				dbit = (dx & 1) << 2;
-				dacc = png->img[doff];
-				mask = 0xf0 >> dbit;
-				for (x = 0; x < w; x++) {
-					dacc = (dacc & ~mask) |
-						((colors[(sacc>>7)&1] << (4-dbit)) & mask);
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-					if (dbit == 4) {
-						dbit = 0;
-						png->img[doff++] = dacc;
-						dacc = png->img[doff];
-						mask = 0xf0;
-					} else {
-						dbit += 4;
-						mask >>= 4;
-					}
-				}
-				png->img[doff] = dacc;
-			}
-			break;
-		case 8:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << sbit;
-				doff = 1 + (dy + y) * png->stride + dx;
-				mask = 0xff;
-				for (x = 0; x < w; x++) {
-					dacc = colors[(sacc>>7)&1] & mask;
-					png->img[doff++] = dacc;
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-				}
-			}
-			break;
 		case 16:
 			for (y = 0; y < h; y++) {
 				soff = (sy + y) * stride + sx / 8;
@@ -2819,129 +3404,6 @@ int png_blit_1bpp(png_t *png, int dx, int dy, int sx, int sy,
 			return -1;
 		}
 		break;
-	case COLOR_PALETTE:
-		switch (png->depth) {
-		case 1:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << sbit;
-				doff = 1 + (dy + y) * png->stride + dx / 8;
-				dbit = dx & 7;
-				dacc = png->img[doff];
-				mask = 0x80 >> dbit;
-				for (x = 0; x < w; x++) {
-					dacc = (dacc & ~mask) |
-						((colors[(sacc>>7)&1] << (7-dbit)) & mask);
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-					if (dbit == 7) {
-						dbit = 0;
-						png->img[doff++] = dacc;
-						dacc = png->img[doff];
-						mask = 0x80;
-					} else {
-						dbit++;
-						mask >>= 1;
-					}
-				}
-				png->img[doff] = dacc;
-			}
-			break;
-		case 2:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << sbit;
-				doff = 1 + (dy + y) * png->stride + dx / 4;
-				dbit = (dx & 3) << 1;
-				dacc = png->img[doff];
-				mask = 0xc0 >> dbit;
-				for (x = 0; x < w; x++) {
-					dacc = (dacc & ~mask) |
-						((colors[(sacc>>7)&1] << (6-dbit)) & mask);
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-					if (dbit == 6) {
-						dbit = 0;
-						png->img[doff++] = dacc;
-						dacc = png->img[doff];
-						mask = 0xc0;
-					} else {
-						dbit += 2;
-						mask >>= 2;
-					}
-				}
-				png->img[doff] = dacc;
-			}
-			break;
-		case 4:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << sbit;
-				doff = 1 + (dy + y) * png->stride + dx / 2;
-				dbit = (dx & 1) << 2;
-				dacc = png->img[doff];
-				mask = 0xf0 >> dbit;
-				for (x = 0; x < w; x++) {
-					dacc = (dacc & ~mask) |
-						((colors[(sacc>>7)&1] << (4-dbit)) & mask);
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-					if (dbit == 4) {
-						dbit = 0;
-						png->img[doff++] = dacc;
-						dacc = png->img[doff];
-						mask = 0xf0;
-					} else {
-						dbit += 4;
-						mask >>= 4;
-					}
-				}
-				png->img[doff] = dacc;
-			}
-			break;
-		case 8:
-			for (y = 0; y < h; y++) {
-				soff = (sy + y) * stride + sx / 8;
-				sbit = sx & 7;
-				sacc = src[sxor ^ soff++] << sbit;
-				doff = 1 + (dy + y) * png->stride + dx;
-				mask = 0xff;
-				for (x = 0; x < w; x++) {
-					dacc = colors[(sacc>>7)&1] & mask;
-					png->img[doff++] = dacc;
-					if (sbit == 7) {
-						sbit = 0;
-						sacc = src[sxor ^ soff++];
-					} else {
-						sbit++;
-						sacc <<= 1;
-					}
-				}
-			}
-			break;
-		default:
-			errno = EINVAL;
-			return -1;
-		}
-		break;
 	case COLOR_GRAYALPHA:
 		switch (png->depth) {
 		case 8:
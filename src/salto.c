@@ -28,7 +28,14 @@
 #include <string.h>
 #include <sys/time.h>
 #include <sys/stat.h>
+#include <signal.h>
+#include <setjmp.h>
 #include <SDL.h>
+#if	defined(__AVX2__)
+#include <immintrin.h>
+#elif	defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "alto.h"
 #include "cpu.h"
@@ -57,6 +64,16 @@
 #define	FRONTEND_ICONS	0
 #endif
 
+/** @brief non-zero to build a frontend without video output and event polling */
+#ifndef	HEADLESS
+#define	HEADLESS	0
+#endif
+
+/** @brief non-zero to run the emulation on a thread of its own, and SDL on the main thread */
+#ifndef	RENDER_THREAD
+#define	RENDER_THREAD	(!HEADLESS)
+#endif
+
 #if	FRONTEND_ICONS
 /* XXX: hackish, should have a header */
 extern uint8_t ppm_led_blank[];
@@ -91,8 +108,8 @@ char title[256] = "SALTO - Simulating the Xerox Alto II";
 /** @brief non-zero if SDL cursor is also shown inside the alto surface */
 int sdl_cursor;
 
-/** @brief non-zero if simualtion shall shut down */
-int halted;
+/** @brief non-zero if simualtion shall shut down (also set by signal handlers) */
+volatile sig_atomic_t halted;
 
 /** @brief non-zero if simualtion shall pause */
 int paused;
@@ -106,12 +123,33 @@ int dump;
 /** @brief non-zero if unknown/unmapped keys should be reported to stderr */
 int report_key;
 
+/** @brief number of frames to run before exiting (0 = no limit) */
+static int frames_max;
+
+/** @brief number of frames run so far */
+static int frames;
+
+/** @brief non-zero if a PNG screenshot shall be taken at exit */
+static int shot_at_exit;
+
 /** @brief MNG context if full frame snapshots are active */
 mng_t *mng;
 
 /** @brief number of bytes written to the MNG */
 size_t xngsize;
 
+/** @brief non-zero if MNG recording shall start right away */
+static int mng_at_start;
+
+/** @brief zlib compression level for the MNG frames */
+static int mng_level = 5;
+
+/** @brief maximum number of MNG frames queued for the encoder threads */
+static int mng_depth = 8;
+
+/** @brief number of MNG encoder threads */
+static int mng_threads = 2;
+
 #if	FRONTEND_ICONS
 #define	BORDER_H	(30+4)
 #define	BORDER_Y	30
@@ -122,15 +160,16 @@ size_t xngsize;
 #define	BORDER_W	8
 #define	BORDER_X	(BORDER_W/2)
 
+#if	!HEADLESS
 static SDL_Surface *screen = NULL;
 static SDL_Surface *alto = NULL;
 static SDL_Surface *debug = NULL;
-static SDL_Surface *pixels = NULL;
 static SDL_Surface *charmap = NULL;
 static SDL_Cursor *cursor = NULL;
 #if	FRONTEND_ICONS
 static SDL_Surface *iconmap = NULL;
 #endif
+#endif
 
 #define	MOUSE_ICON_X	BORDER_X
 #define	MOUSE_ICON_Y	DBG_FONT_H
@@ -142,15 +181,22 @@ static SDL_Surface *iconmap = NULL;
 #define	FOREGROUND_RGB	  0,  0,  0
 #define	HIGHLIGHT_RGB	208,208,255
 
+#if	!HEADLESS
 static int mousex;
 static int mousey;
 static int mouseb;
+/** @brief alto surface pixel value for a 0 bit (background) */
+static uint32_t alto_bg;
+/** @brief alto surface pixel value for a 1 bit xor alto_bg */
+static uint32_t alto_fg;
+
+static int sdl_icon(int x, int y, int type);
+#endif
 static char *bootimg_name = NULL;
-static int minx = -1;
-static int miny = -1;
-static int maxx = -1;
-static int maxy = -1;
 
+static int sdl_print(int x, int y, const char *str);
+
+#if	!HEADLESS
 /**
  * @brief make a cursor from a string of "pixels"
  *
@@ -232,15 +278,194 @@ static __inline void sdl_blit(SDL_Surface *ds, SDL_Surface *ss,
 	SDL_BlitSurface(ss, &sr, ds, &dr);
 }
 
+/** @brief drawing commands from the emulator to the video thread */
+typedef enum {
+	/** @brief write a character to the border */
+	cmd_putch,
+	/** @brief draw a LED icon */
+	cmd_icon,
+	/** @brief write a character cell to the debug surface */
+	cmd_debug,
+	/** @brief switch between the Alto and the debug view */
+	cmd_view
+}	sdl_op_t;
+
+/** @brief a drawing command with its arguments */
+typedef struct {
+	/** @brief command code */
+	sdl_op_t op;
+
+	/** @brief x coordinate */
+	int x;
+
+	/** @brief y coordinate */
+	int y;
+
+	/** @brief first argument: character, icon type, or view */
+	int a;
+
+	/** @brief second argument: color */
+	int b;
+}	sdl_cmd_t;
+
+static void sdl_execute(const sdl_cmd_t *cmd);
+
+#if	RENDER_THREAD
+/** @brief size of the command queue (power of 2) */
+#define	CMD_QUEUE_SIZE		4096
+
+/** @brief size of the event queue (power of 2) */
+#define	EVENT_QUEUE_SIZE	256
+
+/** @brief commands from the emulator thread to the video thread */
+static sdl_cmd_t cmd_queue[CMD_QUEUE_SIZE];
+
+/** @brief command queue write index; written by the emulator thread only */
+static unsigned cmd_head;
+
+/** @brief command queue read index; written by the video thread only */
+static unsigned cmd_tail;
+
+/** @brief input events from the video thread to the emulator thread */
+static SDL_Event event_queue[EVENT_QUEUE_SIZE];
+
+/** @brief event queue write index; written by the video thread only */
+static unsigned event_head;
+
+/** @brief event queue read index; written by the emulator thread only */
+static unsigned event_tail;
+
+/** @brief semaphore to wake up the video thread */
+static SDL_sem *render_sem;
+
+/** @brief thread id of the video thread */
+static Uint32 render_id;
+
+/** @brief non-zero while the emulation runs on its own thread */
+static int render_active;
+
+/** @brief set by the emulator thread when it returns */
+static int emulator_done;
+
+/** @brief thread id of the emulator thread */
+static Uint32 emulator_id;
+
+/** @brief the emulator thread, until the video thread joined it */
+static SDL_Thread *emulator_thread;
+
+/** @brief where fatal() on the emulator thread continues */
+static jmp_buf emulator_fatal;
+
+/** @brief exit code of a fatal() on the emulator thread, or -1 */
+static int emulator_exitcode = -1;
+
+/** @brief wake up the video thread, unless it is awake already */
+static void render_wakeup(void)
+{
+	if (0 == SDL_SemValue(render_sem))
+		SDL_SemPost(render_sem);
+}
+
 /**
- * @brief write a character to the surface border
+ * @brief take the next command from the queue (video thread)
+ *
+ * @param cmd pointer to a command to fill
+ * @result returns 1 if a command was taken, 0 if the queue is empty
+ */
+static int cmd_get(sdl_cmd_t *cmd)
+{
+	unsigned tail = cmd_tail;
+
+	if (tail == __atomic_load_n(&cmd_head, __ATOMIC_ACQUIRE))
+		return 0;
+	*cmd = cmd_queue[tail % CMD_QUEUE_SIZE];
+	__atomic_store_n(&cmd_tail, tail + 1, __ATOMIC_RELEASE);
+	return 1;
+}
+
+/**
+ * @brief pass an input event to the emulator thread (video thread)
+ *
+ * Events are dropped if the emulator does not keep up with them.
+ *
+ * @param ev pointer to the event
+ */
+static void event_put(const SDL_Event *ev)
+{
+	unsigned head = event_head;
+
+	if (head - __atomic_load_n(&event_tail, __ATOMIC_ACQUIRE) == EVENT_QUEUE_SIZE)
+		return;
+	event_queue[head % EVENT_QUEUE_SIZE] = *ev;
+	__atomic_store_n(&event_head, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief take the next input event from the queue (emulator thread)
+ *
+ * @param ev pointer to an event to fill
+ * @result returns 1 if an event was taken, 0 if the queue is empty
+ */
+static int event_get(SDL_Event *ev)
+{
+	unsigned tail = event_tail;
+
+	if (tail == __atomic_load_n(&event_head, __ATOMIC_ACQUIRE))
+		return 0;
+	*ev = event_queue[tail % EVENT_QUEUE_SIZE];
+	__atomic_store_n(&event_tail, tail + 1, __ATOMIC_RELEASE);
+	return 1;
+}
+#endif	/* RENDER_THREAD */
+
+/**
+ * @brief execute a drawing command, or queue it for the video thread
+ *
+ * @param op command code
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param a first argument
+ * @param b second argument
+ * @result 0 on success
+ */
+static int sdl_command(sdl_op_t op, int x, int y, int a, int b)
+{
+	sdl_cmd_t cmd;
+#if	RENDER_THREAD
+	unsigned head;
+#endif
+
+	cmd.op = op;
+	cmd.x = x;
+	cmd.y = y;
+	cmd.a = a;
+	cmd.b = b;
+#if	RENDER_THREAD
+	if (render_active) {
+		head = cmd_head;
+		while (head - __atomic_load_n(&cmd_tail, __ATOMIC_ACQUIRE) == CMD_QUEUE_SIZE) {
+			/* the queue is full: let the video thread catch up */
+			render_wakeup();
+			SDL_Delay(1);
+		}
+		cmd_queue[head % CMD_QUEUE_SIZE] = cmd;
+		__atomic_store_n(&cmd_head, head + 1, __ATOMIC_RELEASE);
+		return 0;
+	}
+#endif
+	sdl_execute(&cmd);
+	return 0;
+}
+
+/**
+ * @brief write a character to the screen border (video thread)
  *
  * @param x x coordinate where to write the character
  * @param y y coordinate where to write the character
  * @param ch character code to write
  * @result 0 on success, -1 on error
  */
-int border_putch(int x, int y, uint8_t ch)
+static int sdl_putch(int x, int y, int ch)
 {
 	int sx = ch * DBG_FONT_W;
 	int sy = 0;
@@ -262,6 +487,38 @@ int border_putch(int x, int y, uint8_t ch)
 	return 0;
 }
 
+/**
+ * @brief print a string to the screen border (video thread)
+ *
+ * @param x x coordinate where to write the string
+ * @param y y coordinate where to write the string
+ * @param str string to print
+ * @result number of characters printed
+ */
+static int sdl_print(int x, int y, const char *str)
+{
+	int len;
+
+	for (len = 0; str[len]; len++) {
+		sdl_putch(x, y, (uint8_t)str[len]);
+		x += DBG_FONT_W;
+	}
+	return len;
+}
+
+/**
+ * @brief write a character to the surface border
+ *
+ * @param x x coordinate where to write the character
+ * @param y y coordinate where to write the character
+ * @param ch character code to write
+ * @result 0 on success, -1 on error
+ */
+int border_putch(int x, int y, uint8_t ch)
+{
+	return sdl_command(cmd_putch, x, y, ch, 0);
+}
+
 /**
  * @brief print a string to the surface border
  *
@@ -272,13 +529,15 @@ int border_putch(int x, int y, uint8_t ch)
  */
 int border_printf(int x, int y, const char *fmt, ...)
 {
-	static char buff[256];
+	char buff[256];
 	int i, len;
 	va_list ap;
 
 	va_start(ap, fmt);
 	len = vsnprintf(buff, sizeof(buff), fmt, ap);
 	va_end(ap);
+	if (len >= (int)sizeof(buff))
+		len = sizeof(buff) - 1;
 	for (i = 0; i < len; i++) {
 		border_putch(x, y, buff[i]);
 		x += DBG_FONT_W;
@@ -326,6 +585,8 @@ static int sdl_close_display(void)
 }
 
 
+#endif	/* !HEADLESS */
+
 /**
  * @brief callback for mng_finish() or png_finish() to emit a byte
  *
@@ -345,19 +606,211 @@ static int fp_write_bytes(void *cookie, uint8_t *bytes, int size)
 	return 0;
 }
 
+/** @brief maximum number of MNG encoder threads */
+#define	MNG_THREADS_MAX	16
+
+/** @brief maximum number of queued MNG frames */
+#define	MNG_DEPTH_MAX	256
+
+/** @brief maximum number of dirty rectangles in a MNG frame */
+#define	MNG_RECTS_MAX	16
+
+/** @brief number of clean words in a scanline which split a dirty rectangle */
+#define	MNG_GAP_WORDS	4
+
+/** @brief number of clean scanlines which split a dirty rectangle */
+#define	MNG_GAP_LINES	16
+
+/** @brief a dirty rectangle in words (x) and scanlines (y) */
+typedef struct {
+	/** @brief first word */
+	int x0;
+
+	/** @brief first scanline */
+	int y0;
+
+	/** @brief last word + 1 */
+	int x1;
+
+	/** @brief last scanline + 1 */
+	int y1;
+}	mng_rect_t;
+
+/** @brief a frame in the MNG recording queue */
+typedef struct {
+	/** @brief PNG images of the frame's dirty rectangles */
+	png_t *png[MNG_RECTS_MAX];
+
+	/** @brief x locations of the images in the frame */
+	int x[MNG_RECTS_MAX];
+
+	/** @brief y locations of the images in the frame */
+	int y[MNG_RECTS_MAX];
+
+	/** @brief number of images */
+	int count;
+
+	/** @brief number of fields (ticks) the frame is shown */
+	int delay;
+
+	/** @brief non-zero when the image data is compressed */
+	int encoded;
+}	mng_job_t;
+
+/**
+ * @brief MNG recording queue
+ *
+ * Frames are queued in order at put. The encoder threads take them at
+ * enc and compress them in parallel, and the writer thread writes them
+ * to the stream in order at wr. Recording only waits if the queue is full.
+ *
+ * The writer keeps the last frame queued until the next one comes, so
+ * unchanged fields can still extend its delay.
+ */
+typedef struct {
+	/** @brief mutex protecting the queue */
+	SDL_mutex *lock;
+
+	/** @brief condition signalled whenever the queue changes */
+	SDL_cond *change;
+
+	/** @brief encoder threads */
+	SDL_Thread *encoder[MNG_THREADS_MAX];
+
+	/** @brief writer thread */
+	SDL_Thread *writer;
+
+	/** @brief ring of queued frames, mng_depth entries used */
+	mng_job_t job[MNG_DEPTH_MAX];
+
+	/** @brief number of frames queued */
+	unsigned put;
+
+	/** @brief number of frames taken by the encoder threads */
+	unsigned enc;
+
+	/** @brief number of frames written */
+	unsigned wr;
+
+	/** @brief set to stop the threads once the queue is empty */
+	int quit;
+
+	/** @brief errno of the first failed write, 0 if none */
+	int error;
+
+	/** @brief number of bytes written after the last frame */
+	size_t size;
+}	mng_queue_t;
+
+/** @brief the MNG recording queue */
+static mng_queue_t mngq;
+
+/** @brief non-zero if the next MNG frame shall contain the whole screen */
+static int mng_full;
+
+/**
+ * @brief MNG encoder thread: compress the queued frames
+ *
+ * @param arg unused
+ * @result 0
+ */
+static int mng_encoder(void *arg)
+{
+	mng_job_t *job;
+	int i;
+
+	SDL_LockMutex(mngq.lock);
+	for (;;) {
+		while (mngq.enc == mngq.put && !mngq.quit)
+			SDL_CondWait(mngq.change, mngq.lock);
+		if (mngq.enc == mngq.put)
+			break;
+		job = &mngq.job[mngq.enc++ % mng_depth];
+		SDL_UnlockMutex(mngq.lock);
+
+		/* if this fails, png_finish_mng() tries again */
+		for (i = 0; i < job->count; i++)
+			png_compress(job->png[i], mng_level);
+
+		SDL_LockMutex(mngq.lock);
+		job->encoded = 1;
+		SDL_CondBroadcast(mngq.change);
+	}
+	SDL_UnlockMutex(mngq.lock);
+	return 0;
+}
+
+/**
+ * @brief MNG writer thread: write the compressed frames in order
+ *
+ * @param arg unused
+ * @result 0
+ */
+static int mng_writer(void *arg)
+{
+	mng_job_t *job;
+	int i, rc;
+
+	SDL_LockMutex(mngq.lock);
+	for (;;) {
+		/* wait for the frame, and for the next one to know its delay */
+		while (mngq.wr == mngq.put ? !mngq.quit :
+			!mngq.job[mngq.wr % mng_depth].encoded ||
+			(mngq.wr + 1 == mngq.put && !mngq.quit))
+			SDL_CondWait(mngq.change, mngq.lock);
+		if (mngq.wr == mngq.put)
+			break;
+		job = &mngq.job[mngq.wr % mng_depth];
+		SDL_UnlockMutex(mngq.lock);
+
+		rc = mng_start_frame(mng, job->delay);
+		for (i = 0; i < job->count; i++) {
+			if (0 == rc)
+				rc = mng_append_image(mng, job->png[i], job->x[i], job->y[i]);
+			else
+				png_discard(job->png[i]);
+			job->png[i] = NULL;
+		}
+
+		SDL_LockMutex(mngq.lock);
+		if (0 != rc && 0 == mngq.error)
+			mngq.error = errno ? errno : EIO;
+		job->count = 0;
+		job->encoded = 0;
+		mngq.size = xngsize;
+		mngq.wr++;
+		SDL_CondBroadcast(mngq.change);
+	}
+	SDL_UnlockMutex(mngq.lock);
+	return 0;
+}
+
 /**
  * @brief stop MNG screenshot recording
  */
 void screenmng_stop(void)
 {
+	char buff[32];
 	size_t kb;
 	FILE *fp;
 	off_t pos;
+	int i;
 
 	fp = xng_get_cookie(mng);
 	if (!fp)
 		return;
 
+	/* let the threads write the queued frames, then join them */
+	SDL_LockMutex(mngq.lock);
+	mngq.quit = 1;
+	SDL_CondBroadcast(mngq.change);
+	SDL_UnlockMutex(mngq.lock);
+	for (i = 0; i < mng_threads; i++)
+		SDL_WaitThread(mngq.encoder[i], NULL);
+	SDL_WaitThread(mngq.writer, NULL);
+	SDL_DestroyCond(mngq.change);
+	SDL_DestroyMutex(mngq.lock);
+
 	/* remember where we are and seek to the file pos where the MHDR is */
 	pos = ftell(fp);
 	fseek(fp, 8, SEEK_SET);
@@ -373,8 +826,9 @@ void screenmng_stop(void)
 
 	fclose(fp);
 	kb = (xngsize + 1023) / 1024;
+	snprintf(buff, sizeof(buff), "(%dKB)", (int)kb);
 	sdl_draw_icon(MNG_ICON_X, MNG_ICON_Y, mng_off);
-	border_printf(MNG_ICON_X, 0, "(%dKB)", kb);
+	sdl_print(MNG_ICON_X, 0, buff);
 	return;
 }
 
@@ -385,6 +839,7 @@ void screenmng_start(void)
 {
 	static char filename[FILENAME_MAX] = "alto.mng";
 	FILE *fp;
+	int i;
 
 	if (mng)
 		screenmng_stop();
@@ -404,60 +859,213 @@ void screenmng_start(void)
 	mng->comment = "SALTO screen MNG";
 	mng->author = "$Id: salto.c,v 1.2 2008/08/19 14:07:22 pm Exp $";
 	xngsize = 0;
+
+	if (mng_level < 0 || mng_level > 9)
+		mng_level = 5;
+	if (mng_depth < 2 || mng_depth > MNG_DEPTH_MAX)
+		mng_depth = 8;
+	if (mng_threads < 1 || mng_threads > MNG_THREADS_MAX)
+		mng_threads = 2;
+
+	memset(&mngq, 0, sizeof(mngq));
+	mng_full = 1;
+	mngq.lock = SDL_CreateMutex();
+	mngq.change = SDL_CreateCond();
+	if (!mngq.lock || !mngq.change)
+		fatal(1, "Cannot create the MNG queue mutex\n");
+	mngq.writer = SDL_CreateThread(mng_writer, NULL);
+	if (!mngq.writer)
+		fatal(1, "Cannot create the MNG writer thread\n");
+	for (i = 0; i < mng_threads; i++) {
+		mngq.encoder[i] = SDL_CreateThread(mng_encoder, NULL);
+		if (!mngq.encoder[i])
+			fatal(1, "Cannot create MNG encoder thread #%d\n", i);
+	}
+}
+
+#if	!HEADLESS
+/**
+ * @brief start or stop MNG screenshot recording (emulator thread)
+ */
+static void screenmng_toggle(void)
+{
+	if (mng)
+		screenmng_stop();
+	else
+		screenmng_start();
+}
+#endif
+
+/**
+ * @brief find the dirty rectangles of a frame
+ *
+ * Scanlines with changes are collected in bands, as long as there are
+ * less than MNG_GAP_LINES clean scanlines between them. The words
+ * changed in a band are split where there are MNG_GAP_WORDS or more
+ * clean words in a row, and each part is trimmed to its first and
+ * last changed scanline.
+ *
+ * @param rect array of MNG_RECTS_MAX rectangles to fill
+ * @param dirty bitmaps of the changed words per scanline
+ * @result number of rectangles; 1 bounding box if there are too many
+ */
+static int mng_dirty_rects(mng_rect_t *rect, const uint64_t *dirty)
+{
+	uint64_t band, mask;
+	int n = 0, x, x0, x1, y, y0, y1;
+
+	for (y = 0; y < DISPLAY_HEIGHT; ) {
+		if (0 == dirty[y]) {
+			y++;
+			continue;
+		}
+		band = 0;
+		y0 = y;
+		for (y1 = y; y < DISPLAY_HEIGHT && y - y1 < MNG_GAP_LINES; y++) {
+			if (0 == dirty[y])
+				continue;
+			band |= dirty[y];
+			y1 = y + 1;
+		}
+		for (x = 0; x < DISPLAY_VISIBLE_WORDS; ) {
+			if (0 == ((band >> x) & 1)) {
+				x++;
+				continue;
+			}
+			x0 = x;
+			for (x1 = x; x < DISPLAY_VISIBLE_WORDS && x - x1 < MNG_GAP_WORDS; x++) {
+				if ((band >> x) & 1)
+					x1 = x + 1;
+			}
+			if (n == MNG_RECTS_MAX)
+				goto bounding_box;
+			mask = (~(uint64_t)0 >> (64 - (x1 - x0))) << x0;
+			rect[n].x0 = x0;
+			rect[n].x1 = x1;
+			for (rect[n].y0 = y0; 0 == (dirty[rect[n].y0] & mask); rect[n].y0++)
+				;
+			for (rect[n].y1 = y1; 0 == (dirty[rect[n].y1 - 1] & mask); rect[n].y1--)
+				;
+			n++;
+		}
+	}
+	return n;
+
+bounding_box:
+	/* too many rectangles: use the bounding box of all changes */
+	band = 0;
+	rect[0].y0 = -1;
+	for (y = 0; y < DISPLAY_HEIGHT; y++) {
+		if (0 == dirty[y])
+			continue;
+		if (rect[0].y0 < 0)
+			rect[0].y0 = y;
+		rect[0].y1 = y + 1;
+		band |= dirty[y];
+	}
+	for (rect[0].x0 = 0; 0 == ((band >> rect[0].x0) & 1); rect[0].x0++)
+		;
+	for (rect[0].x1 = DISPLAY_VISIBLE_WORDS; 0 == ((band >> (rect[0].x1 - 1)) & 1); rect[0].x1--)
+		;
+	return 1;
 }
 
 /**
- * @brief write a screen frame to the MNG stream
+ * @brief queue a screen frame for the MNG stream
+ *
+ * The dirty rectangles are copied to PNG images right away; compressing
+ * and writing them is left to the encoder and writer threads. If
+ * nothing changed, the previous frame is shown one tick longer.
+ *
+ * @param bitmap pointer to the frame's raw bitmap, or NULL for dsp.raw_bitmap
+ * @param dirty bitmaps of the changed words per scanline, or NULL for dsp.dirty_words
  */
-void screenmng_frame(void)
+void screenmng_frame(const uint16_t *bitmap, uint64_t *dirty)
 {
+	mng_rect_t rect[MNG_RECTS_MAX];
+	png_t *png[MNG_RECTS_MAX];
+	char buff[32];
 	size_t kb;
-	png_t *png;
-	int left, right, top, bottom, w, h;
+	mng_job_t *job;
+	int left, right, top, bottom;
+	int i, n, error, count;
+
+	if (NULL == dirty)
+		dirty = dsp.dirty_words;
 
 	/* recording is off, or simulation is paused */
-	if (NULL == mng || paused)
+	if (NULL == mng || __atomic_load_n(&paused, __ATOMIC_ACQUIRE))
 		return;
 
-	left = minx < DISPLAY_WIDTH - 1 ? minx : DISPLAY_WIDTH - 1;
-	top = miny < DISPLAY_HEIGHT - 1 ? miny : DISPLAY_HEIGHT - 1;
-	right = maxx < DISPLAY_WIDTH ? maxx : DISPLAY_WIDTH;
-	bottom = maxy < DISPLAY_HEIGHT ? maxy : DISPLAY_HEIGHT;
-
-	minx = -1;
-	miny = -1;
-	maxx = -1;
-	maxy = -1;
-
-	if (-1 == left || -1 == top || -1 == right || -1 == bottom) {
-		/* write first 16 pixels rather than nothing (?) */
-		left = 0;
-		top = 0;
-		right = 16;
-		bottom = 1;
+	if (mng_full) {
+		/* the first frame of a recording has the whole screen */
+		rect[0].x0 = 0;
+		rect[0].y0 = 0;
+		rect[0].x1 = DISPLAY_VISIBLE_WORDS;
+		rect[0].y1 = DISPLAY_HEIGHT;
+		n = 1;
+		mng_full = 0;
+	} else {
+		n = mng_dirty_rects(rect, dirty);
 	}
+	memset(dirty, 0, DISPLAY_HEIGHT * sizeof(*dirty));
 
-	w = right - left;
-	h = bottom - top;
+	for (i = 0; i < n; i++) {
+		left = rect[i].x0 * 16;
+		top = rect[i].y0;
+		right = rect[i].x1 * 16 < DISPLAY_WIDTH ? rect[i].x1 * 16 : DISPLAY_WIDTH;
+		bottom = rect[i].y1;
 
-	png = mng_append_png(mng, left, top, w, h, COLOR_PALETTE, 1);
-	if (!png)
-		fatal(1, "mng_append_png() failed (%s)\n",
-			strerror(errno));
+		png[i] = png_create(right - left, bottom - top, COLOR_PALETTE, 1, NULL, NULL);
+		if (!png[i])
+			fatal(1, "png_create() failed (%s)\n",
+				strerror(errno));
+
+		/* copy the screenshot */
+		display_screenshot(png[i], bitmap, left, top, right, bottom);
+	}
+
+	SDL_LockMutex(mngq.lock);
+	if (0 == n) {
+		/* nothing changed: extend the delay of the previous frame */
+		if (mngq.put != mngq.wr)
+			mngq.job[(mngq.put - 1) % mng_depth].delay++;
+	} else {
+		/* queue the frame, waiting only if the queue is full */
+		while (mngq.put - mngq.wr >= (unsigned)mng_depth)
+			SDL_CondWait(mngq.change, mngq.lock);
+		job = &mngq.job[mngq.put++ % mng_depth];
+		for (i = 0; i < n; i++) {
+			job->png[i] = png[i];
+			job->x[i] = rect[i].x0 * 16;
+			job->y[i] = rect[i].y0;
+		}
+		job->count = n;
+		job->delay = 1;
+		job->encoded = 0;
+		SDL_CondBroadcast(mngq.change);
+	}
+	error = mngq.error;
+	count = mngq.put;
+	kb = (mngq.size + 1023) / 1024;
+	SDL_UnlockMutex(mngq.lock);
 
-	/* append the screenshot */
-	display_screenshot(png, left, top, right, bottom);
+	if (error)
+		fatal(1, "Writing the MNG stream failed (%s)\n",
+			strerror(error));
 
 	/* write the progress info to the border */
-	kb = (xngsize + 1023) / 1024;
-	sdl_draw_icon(MNG_ICON_X, MNG_ICON_Y, mng_on0 + (mng_get_fcount(mng) & 3));
-	border_printf(MNG_ICON_X, 0, "%dKB", kb);
+	snprintf(buff, sizeof(buff), "%dKB", (int)kb);
+	sdl_draw_icon(MNG_ICON_X, MNG_ICON_Y, mng_on0 + (count & 3));
+	sdl_print(MNG_ICON_X, 0, buff);
 }
 
 /**
  * @brief create a screenshot PNG file
+ *
+ * @param bitmap pointer to the frame's raw bitmap, or NULL for dsp.raw_bitmap
  */
-static void screenshot(void)
+static void screenshot(const uint16_t *bitmap)
 {
 	static uint16_t id;
 	static char filename[FILENAME_MAX] = "alto0000.png";
@@ -481,7 +1089,7 @@ static void screenshot(void)
 	png->author = "$Id: salto.c,v 1.2 2008/08/19 14:07:22 pm Exp $";
 
 	/* copy the display to the PNG */
-	display_screenshot(png, 0, 0, DISPLAY_WIDTH-1, DISPLAY_HEIGHT-1);
+	display_screenshot(png, bitmap, 0, 0, DISPLAY_WIDTH-1, DISPLAY_HEIGHT-1);
 
 	/* and finish it */
 	if (0 != png_finish(png))
@@ -490,6 +1098,20 @@ static void screenshot(void)
 	fclose(fp);
 }
 
+/**
+ * @brief record and count a frame, stop after the requested number of frames
+ *
+ * Every emulated frame is recorded here, on the emulator thread, so the
+ * MNG stream has all of them and the emulator waits when its queue is full.
+ */
+static void frame_done(void)
+{
+	screenmng_frame(NULL, NULL);
+	if (frames_max > 0 && ++frames >= frames_max)
+		__atomic_store_n(&halted, 1, __ATOMIC_RELEASE);
+}
+
+#if	!HEADLESS
 #define	PC_START 0
 static void bootimg(void)
 {
@@ -523,15 +1145,18 @@ static void bootimg(void)
 		bootimg_name, PC_START, pc, cpu.r[6]);
 }
 
+/** @brief surface shown on the screen (0 Alto, else debug); owned by the video thread */
+static int view;
+
 /**
- * @brief switch between Alto bitmap view and debug output view
+ * @brief show the Alto bitmap or the debug surface (video thread)
  *
  * @param which which surface to draw to screen (0 Alto, else debug)
  */
-void debug_view(int which)
+static void sdl_view(int which)
 {
-	dbg.visible = which;
-	if (dbg.visible) {
+	view = which;
+	if (view) {
 		sdl_blit(screen, debug,
 			BORDER_X, BORDER_Y, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
 	} else {
@@ -542,148 +1167,228 @@ void debug_view(int which)
 }
 
 /**
- * @brief update changes to the off screen surface to the screen, poll events
+ * @brief switch between Alto bitmap view and debug output view
  *
- * Clips the changes that were made to the surface since the last call
- * to sdl_update() and blits them to the screen.
+ * @param which which surface to draw to screen (0 Alto, else debug)
+ */
+void debug_view(int which)
+{
+	dbg.visible = which;
+	sdl_command(cmd_view, 0, 0, which, 0);
+}
+
+#if	RENDER_THREAD
+/** @brief frame buffer flag: published by the emulator, not yet taken */
+#define	FRAME_FRESH	4
+
+/**
+ * @brief three frame buffers for the raw bitmap
  *
- * Polls the SDL events and handles key presses and releases, mouse
- * movements and button clicks, and close window (exit) event.
+ * The emulator thread fills frame_back, the video thread shows
+ * frame_front, and they swap their buffer with frame_mid.
+ */
+static uint16_t frame_buff[3][DISPLAY_HEIGHT][DISPLAY_VISIBLE_WORDS];
+
+/** @brief frame buffer filled by the emulator thread */
+static int frame_back = 0;
+
+/** @brief frame buffer in between, ored with FRAME_FRESH when published */
+static int frame_mid = 1;
+
+/** @brief frame buffer taken by the video thread */
+static int frame_front = 2;
+
+/** @brief the raw bitmap as it is on the alto surface (video thread) */
+static uint16_t frame_shown[DISPLAY_HEIGHT][DISPLAY_VISIBLE_WORDS];
+
+/** @brief the function run on the emulator thread */
+static int (*render_emulate)(void *);
+
+/**
+ * @brief publish a copy of the raw bitmap to the video thread
+ */
+static void frame_publish(void)
+{
+	memcpy(frame_buff[frame_back], dsp.raw_bitmap, sizeof(dsp.raw_bitmap));
+	frame_back = __atomic_exchange_n(&frame_mid, frame_back | FRAME_FRESH,
+		__ATOMIC_ACQ_REL) & 3;
+	render_wakeup();
+}
+
+/**
+ * @brief take the most recently published frame (video thread)
  *
- * @param full set to non zero, if a full frame update was done (clears screen)
- * @result 0 on success
+ * @result returns 1 if there was a new frame in frame_front, 0 otherwise
  */
-int sdl_update(int full)
+static int frame_take(void)
 {
-	static SDLMod mod_old;
-	SDLMod mod_new;
-	SDL_Event ev;
+	if (0 == (__atomic_load_n(&frame_mid, __ATOMIC_ACQUIRE) & FRAME_FRESH))
+		return 0;
+	frame_front = __atomic_exchange_n(&frame_mid, frame_front,
+		__ATOMIC_ACQ_REL) & 3;
+	return 1;
+}
+#endif	/* RENDER_THREAD */
 
-	while (SDL_PollEvent(&ev)) {
-		switch (ev.type) {
-		case SDL_VIDEORESIZE:
-			if (NULL != screen)
-				SDL_FreeSurface(screen);
-			screen = SDL_SetVideoMode(ev.resize.w, ev.resize.h,
-				0, SDL_HWSURFACE | SDL_RESIZABLE);
-			SDL_ShowCursor(sdl_cursor);
-			SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format,BORDER_RGB));
-			sdl_update(1);
-			break;
+/**
+ * @brief handle the events which concern the window (video thread)
+ *
+ * Resizing, the host cursor, screenshots, and clicks on the mouse icon
+ * are handled here. MNG recording is left to the emulator thread.
+ *
+ * @param ev pointer to the event
+ * @result non-zero if the emulator needs to see the event, too
+ */
+static int sdl_window_event(SDL_Event *ev)
+{
+	switch (ev->type) {
+	case SDL_VIDEORESIZE:
+		if (NULL != screen)
+			SDL_FreeSurface(screen);
+		screen = SDL_SetVideoMode(ev->resize.w, ev->resize.h,
+			0, SDL_HWSURFACE | SDL_RESIZABLE);
+		SDL_ShowCursor(sdl_cursor);
+		SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format,BORDER_RGB));
+		sdl_view(view);
+		return 0;
 
-		case SDL_KEYDOWN:
-			switch (ev.key.keysym.sym) {
-			case SDLK_INSERT:
-				bootimg();
-				break;
-			case SDLK_F10:
-				halted = 1;
-				break;
-				break;
-			case SDLK_RETURN:
-				if (paused && ev.key.keysym.sym == SDLK_RETURN)
-					step = 1;
-				kbd_key(&ev.key.keysym, 1);
-				break;
-			case SDLK_PRINT:
-				if (SDL_GetModState() & KMOD_LCTRL) {
-					/* CTRL+PRINT starts/stops MNG recording */
-					if (mng)
-						screenmng_stop();
-					else
-						screenmng_start();
+	case SDL_KEYDOWN:
+		if (SDLK_PRINT != ev->key.keysym.sym)
+			return 1;
+		if (SDL_GetModState() & KMOD_LCTRL)
+			return 1;
+		/* PRINT takes a single PNG screenshot */
+#if	RENDER_THREAD
+		screenshot(&frame_shown[0][0]);
+#else
+		screenshot(NULL);
+#endif
+		return 0;
+
+	case SDL_MOUSEMOTION:
+		mousex = ev->motion.x;
+		mousey = ev->motion.y;
+		if (mousex < BORDER_X || mousey < BORDER_Y ||
+			mousex >= BORDER_X + DISPLAY_WIDTH ||
+			mousey >= BORDER_Y + DISPLAY_HEIGHT) {
+			SDL_ShowCursor(1);
+		} else {
+			SDL_ShowCursor(sdl_cursor ^ 1);
+		}
+		return 1;
+
+	case SDL_MOUSEBUTTONDOWN:
+		if (mousey < BORDER_Y) {
+			/* click on mouse icon ? */
+			if (mousex >= MOUSE_ICON_X && mousex < MOUSE_ICON_X + 16) {
+				if (__atomic_xor_fetch(&sdl_cursor, 1, __ATOMIC_ACQ_REL)) {
+					sdl_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_on);
 				} else {
-					/* PRINT takes a single PNG screenshot */
-					screenshot();
+					sdl_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_off);
 				}
-				break;
-			default:
-				if (dbg.visible) {
-					dbg_key(&ev.key.keysym, 1);
-					break;
-				}
-				if (0 == kbd_key(&ev.key.keysym, 1))
-					break;
-				if (report_key)
-					unknown_key(ev.key.keysym.sym);
 			}
-			break;
+		}
+		return 1;
 
-		case SDL_KEYUP:
-			switch (ev.key.keysym.sym) {
-			case SDLK_PAUSE:
-				paused ^= 1;
-				break;
-			case SDLK_SCROLLOCK:
-				debug_view(dbg.visible ^ 1);
+	case SDL_QUIT:
+		__atomic_store_n(&halted, 1, __ATOMIC_RELEASE);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * @brief handle the keyboard and mouse events for the emulator
+ *
+ * @param ev pointer to the event
+ */
+static void sdl_emulator_event(SDL_Event *ev)
+{
+	switch (ev->type) {
+	case SDL_KEYDOWN:
+		switch (ev->key.keysym.sym) {
+		case SDLK_INSERT:
+			bootimg();
+			break;
+		case SDLK_F10:
+			__atomic_store_n(&halted, 1, __ATOMIC_RELEASE);
+			break;
+		case SDLK_PRINT:
+			/* CTRL+PRINT starts/stops MNG recording */
+			screenmng_toggle();
+			break;
+		case SDLK_RETURN:
+			if (paused)
+				step = 1;
+			kbd_key(&ev->key.keysym, 1);
+			break;
+		default:
+			if (dbg.visible) {
+				dbg_key(&ev->key.keysym, 1);
 				break;
-			default:
-				if (dbg.visible) {
-					dbg_key(&ev.key.keysym, 0);
-					break;
-				}
-				if (0 == kbd_key(&ev.key.keysym, 0))
-					break;
 			}
-			break;
+			if (0 == kbd_key(&ev->key.keysym, 1))
+				break;
+			if (report_key)
+				unknown_key(ev->key.keysym.sym);
+		}
+		break;
 
-		case SDL_MOUSEMOTION:
-			mousex = ev.motion.x;
-			mousey = ev.motion.y;
-			if (mousex < BORDER_X || mousey < BORDER_Y ||
-				mousex >= BORDER_X + DISPLAY_WIDTH ||
-				mousey >= BORDER_Y + DISPLAY_HEIGHT) {
-				SDL_ShowCursor(1);
-			} else {
-				SDL_ShowCursor(sdl_cursor ^ 1);
-			}
-			if (sdl_cursor) {
-				mouse_motion(mousex - BORDER_X, mousey - BORDER_Y);
-				if ((mouseb ^ ev.motion.state) & 1) {
-					mouseb = (mouseb & ~1) | (ev.motion.state & 1);
-					mouse_button(mouseb);
-				}
-			}
+	case SDL_KEYUP:
+		switch (ev->key.keysym.sym) {
+		case SDLK_PAUSE:
+			__atomic_xor_fetch(&paused, 1, __ATOMIC_ACQ_REL);
 			break;
-
-		case SDL_MOUSEBUTTONDOWN:
-			if (mouse.y < BORDER_Y) {
-				/* click on mouse icon ? */
-				if (mouse.x >= MOUSE_ICON_X && mouse.x < MOUSE_ICON_X + 16) {
-					sdl_cursor ^= 1;
-					if (sdl_cursor) {
-						sdl_draw_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_on);
-					} else {
-						sdl_draw_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_off);
-					}
-				}
-				/* click on mouse the MNG icon ? */
-				if (mouse.x >= MNG_ICON_X && mouse.x <= MNG_ICON_X + 16) {
-					if (mng)
-						screenmng_stop();
-					else
-						screenmng_start();
-				}
-			}
-			if (sdl_cursor) {
-				mouseb |= SDL_BUTTON(ev.button.button);
-				mouse_button(mouseb);
-			}
+		case SDLK_SCROLLOCK:
+			debug_view(dbg.visible ^ 1);
 			break;
+		default:
+			if (dbg.visible) {
+				dbg_key(&ev->key.keysym, 0);
+				break;
+			}
+			kbd_key(&ev->key.keysym, 0);
+		}
+		break;
 
-		case SDL_MOUSEBUTTONUP:
-			if (sdl_cursor) {
-				mouseb &= ~SDL_BUTTON(ev.button.button);
+	case SDL_MOUSEMOTION:
+		if (__atomic_load_n(&sdl_cursor, __ATOMIC_ACQUIRE)) {
+			mouse_motion(ev->motion.x - BORDER_X, ev->motion.y - BORDER_Y);
+			if ((mouseb ^ ev->motion.state) & 1) {
+				mouseb = (mouseb & ~1) | (ev->motion.state & 1);
 				mouse_button(mouseb);
 			}
-			break;
+		}
+		break;
+
+	case SDL_MOUSEBUTTONDOWN:
+		/* click on the MNG icon ? */
+		if (ev->button.y < BORDER_Y &&
+			ev->button.x >= MNG_ICON_X && ev->button.x <= MNG_ICON_X + 16)
+			screenmng_toggle();
+		if (__atomic_load_n(&sdl_cursor, __ATOMIC_ACQUIRE)) {
+			mouseb |= SDL_BUTTON(ev->button.button);
+			mouse_button(mouseb);
+		}
+		break;
 
-		case SDL_QUIT:
-			halted = 1;
+	case SDL_MOUSEBUTTONUP:
+		if (__atomic_load_n(&sdl_cursor, __ATOMIC_ACQUIRE)) {
+			mouseb &= ~SDL_BUTTON(ev->button.button);
+			mouse_button(mouseb);
 		}
+		break;
 	}
+}
+
+/**
+ * @brief check for the GRABKEYS combination (Ctrl+Alt) (video thread)
+ */
+static void sdl_grab_keys(void)
+{
+	static SDLMod mod_old;
+	SDLMod mod_new;
 
-	/* check for GRABKEYS combination (Ctrl+Alt) */
 	mod_new = SDL_GetModState();
 	if ((mod_new & GRABKEYS) == GRABKEYS) {
 		if ((mod_old & GRABKEYS) != GRABKEYS) {
@@ -692,79 +1397,359 @@ int sdl_update(int full)
 				snprintf(buff, sizeof(buff),
 					"%s (Ctrl+Alt to grab mouse)", title);
 				SDL_WM_SetCaption(buff, buff);
-				sdl_cursor = 0;
-				sdl_draw_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_off);
+				__atomic_store_n(&sdl_cursor, 0, __ATOMIC_RELEASE);
+				sdl_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_off);
 			} else {
 				char buff[256];
 				snprintf(buff, sizeof(buff),
 					"%s (Ctrl+Alt to release mouse)", title);
 				SDL_WM_SetCaption(buff, buff);
-				sdl_cursor = 1;
-				sdl_draw_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_on);
+				__atomic_store_n(&sdl_cursor, 1, __ATOMIC_RELEASE);
+				sdl_icon(MOUSE_ICON_X, MOUSE_ICON_Y, mouse_on);
 			}
 		}
 	}
 	mod_old = mod_new;
+}
+
+/**
+ * @brief show a complete frame on the screen (video thread)
+ */
+static void sdl_present(void)
+{
+	SDL_UpdateRect(screen, 0, 0, screen->w, screen->h);
+}
+
+static int sdl_expand_line(int y, int x0, int x1, const uint16_t *words);
+
+/**
+ * @brief update changes to the off screen surface to the screen, poll events
+ *
+ * With RENDER_THREAD this runs on the emulator thread: it handles the
+ * input events queued by the video thread and publishes full frames.
+ * Otherwise it polls the SDL events itself and updates the screen.
+ * This does not count a frame, so it is also used while paused.
+ *
+ * @param full set to non zero, if a full frame update was done (clears screen)
+ * @result 0 on success
+ */
+int sdl_refresh(int full)
+{
+	SDL_Event ev;
+
+#if	RENDER_THREAD
+	while (event_get(&ev))
+		sdl_emulator_event(&ev);
+	if (full)
+		frame_publish();
+#else
+	while (SDL_PollEvent(&ev)) {
+		if (sdl_window_event(&ev))
+			sdl_emulator_event(&ev);
+	}
+	sdl_grab_keys();
+	if (full)
+		sdl_present();
+#endif
+	return 0;
+}
+
+/**
+ * @brief update the screen after the display emulated a frame
+ *
+ * @param full set to non zero, if a full frame update was done (clears screen)
+ * @result 0 on success
+ */
+int sdl_update(int full)
+{
+	sdl_refresh(full);
+	if (full)
+		frame_done();
+	return 0;
+}
+
+/**
+ * @brief draw a LED icon to the screen border (video thread)
+ *
+ * @param x x coordinate where to draw the icon
+ * @param y y coordinate where to draw the icon
+ * @param type one of the led_t enum
+ * @result 0 on success, -1 on error
+ */
+static int sdl_icon(int x, int y, int type)
+{
+#if	FRONTEND_ICONS
+	if (type >= led_count)
+		return -1;
+	sdl_blit(screen, iconmap, x, y + 1, type * 16, 0, 16, 16);
+	SDL_UpdateRect(screen, x, y + 1, 16, 16);
+#endif
+	return 0;
+}
+
+/**
+ * @brief draw a LED icon to the bottom of the SDL surface
+ *
+ * @param x x coordinate where to draw the icon
+ * @param y y coordinate where to draw the icon
+ * @param type one of the led_t enum
+ * @result 0 on success, -1 on error
+ */
+int sdl_draw_icon(int x, int y, int type)
+{
+	return sdl_command(cmd_icon, x, y, type, 0);
+}
 
-	if (full) {
-		SDL_UpdateRect(screen, 0, 0, screen->w, screen->h);
-		screenmng_frame();
+/**
+ * @brief expand display words to alto surface pixels
+ *
+ * Each bit, MSB first, selects the background or foreground pixel value.
+ * The vector versions compare every lane against its bit mask and
+ * select the color with and/xor, so there are no branches per pixel.
+ *
+ * @param dst pointer to the first destination pixel
+ * @param src pointer to the first display word
+ * @param n number of pixels to expand
+ */
+static void sdl_expand(uint32_t *dst, const uint16_t *src, int n)
+{
+	uint32_t word;
+	int i;
+#if	defined(__AVX2__)
+	const __m256i m0 = _mm256_set_epi32(0x0100, 0x0200, 0x0400, 0x0800,
+		0x1000, 0x2000, 0x4000, 0x8000);
+	const __m256i m1 = _mm256_srli_epi32(m0, 8);
+	const __m256i bg = _mm256_set1_epi32(alto_bg);
+	const __m256i fg = _mm256_set1_epi32(alto_fg);
+
+	for (; n >= 16; n -= 16, dst += 16) {
+		__m256i w = _mm256_set1_epi32(*src++);
+		_mm256_storeu_si256((__m256i *)(dst + 0), _mm256_xor_si256(bg,
+			_mm256_and_si256(fg, _mm256_cmpeq_epi32(_mm256_and_si256(w, m0), m0))));
+		_mm256_storeu_si256((__m256i *)(dst + 8), _mm256_xor_si256(bg,
+			_mm256_and_si256(fg, _mm256_cmpeq_epi32(_mm256_and_si256(w, m1), m1))));
+	}
+#elif	defined(__SSE2__)
+	const __m128i m0 = _mm_set_epi32(0x1000, 0x2000, 0x4000, 0x8000);
+	const __m128i m1 = _mm_srli_epi32(m0, 4);
+	const __m128i m2 = _mm_srli_epi32(m0, 8);
+	const __m128i m3 = _mm_srli_epi32(m0, 12);
+	const __m128i bg = _mm_set1_epi32(alto_bg);
+	const __m128i fg = _mm_set1_epi32(alto_fg);
+
+	for (; n >= 16; n -= 16, dst += 16) {
+		__m128i w = _mm_set1_epi32(*src++);
+		_mm_storeu_si128((__m128i *)(dst + 0), _mm_xor_si128(bg,
+			_mm_and_si128(fg, _mm_cmpeq_epi32(_mm_and_si128(w, m0), m0))));
+		_mm_storeu_si128((__m128i *)(dst + 4), _mm_xor_si128(bg,
+			_mm_and_si128(fg, _mm_cmpeq_epi32(_mm_and_si128(w, m1), m1))));
+		_mm_storeu_si128((__m128i *)(dst + 8), _mm_xor_si128(bg,
+			_mm_and_si128(fg, _mm_cmpeq_epi32(_mm_and_si128(w, m2), m2))));
+		_mm_storeu_si128((__m128i *)(dst + 12), _mm_xor_si128(bg,
+			_mm_and_si128(fg, _mm_cmpeq_epi32(_mm_and_si128(w, m3), m3))));
+	}
+#endif
+	/* whole words without vector support, and a partial last word */
+	for (; n > 0; n -= 16, dst += 16) {
+		word = *src++;
+		for (i = 0; i < 16 && i < n; i++)
+			dst[i] = alto_bg ^ (alto_fg & -((word >> (15 - i)) & 1));
 	}
+}
 
+/**
+ * @brief expand a span of display words of one scanline to the SDL surface
+ *
+ * The words are expanded to the alto surface in one pass, then the
+ * span is blitted to the screen, unless the debug view is visible.
+ *
+ * @param y scanline number
+ * @param x0 first word to write
+ * @param x1 last word to write + 1
+ * @param words pointer to the words of the scanline
+ * @result 0 on success, -1 on error
+ */
+static int sdl_expand_line(int y, int x0, int x1, const uint16_t *words)
+{
+	int left = x0 * 16;
+	int right = x1 * 16;
+	uint32_t *dst;
+
+	if (x0 < 0 || x0 >= x1 || y < 0 || y >= DISPLAY_HEIGHT || left >= DISPLAY_WIDTH)
+		return -1;
+
+	if (right > alto->w)
+		right = alto->w;
+	if (y >= alto->h || left >= right)
+		return -1;
+
+	if (SDL_MUSTLOCK(alto) && SDL_LockSurface(alto) < 0)
+		return -1;
+	dst = (uint32_t *)((uint8_t *)alto->pixels + y * alto->pitch) + left;
+	sdl_expand(dst, words + x0, right - left);
+	if (SDL_MUSTLOCK(alto))
+		SDL_UnlockSurface(alto);
+
+	if (!view) {
+		sdl_blit(screen, alto, left + BORDER_X, y + BORDER_Y,
+			left, y, right - left, 1);
+	}
 	return 0;
 }
 
 /**
- * @brief draw a LED icon to the bottom of the SDL surface
+ * @brief write a span of display words of one scanline to the SDL surface
  *
- * @param x x coordinate where to draw the icon
- * @param y y coordinate where to draw the icon
- * @param type one of the led_t enum
+ * With RENDER_THREAD the video thread finds the changed words itself
+ * in the frames published by sdl_update(), so there is nothing to do.
+ *
+ * @param y scanline number
+ * @param x0 first word to write
+ * @param x1 last word to write + 1
+ * @param words pointer to the words of the scanline (raw_bitmap[y])
  * @result 0 on success, -1 on error
  */
-int sdl_draw_icon(int x, int y, int type)
+int sdl_write_line(int y, int x0, int x1, const uint16_t *words)
 {
-#if	FRONTEND_ICONS
-	if (type >= led_count)
-		return -1;
-	sdl_blit(screen, iconmap, x, y + 1, type * 16, 0, 16, 16);
-	SDL_UpdateRect(screen, x, y + 1, 16, 16);
-#endif
+#if	RENDER_THREAD
 	return 0;
+#else
+	return sdl_expand_line(y, x0, x1, words);
+#endif
 }
 
+#if	RENDER_THREAD
 /**
- * @brief write a word with 16 pixels to the SDL surface
+ * @brief expand the words of a frame which changed since the last one
  *
- * @param x x coordinate where to write the word
- * @param y y coordinate where to write the word
- * @param pixel the 16 lower bits, MSB to LSB, define the 16 pixels
- * @result 0 on success, -1 on error
+ * @param bitmap the frame's raw bitmap
  */
-int sdl_write(int x, int y, uint32_t pixel)
+static void sdl_show_frame(uint16_t bitmap[][DISPLAY_VISIBLE_WORDS])
 {
-	int sx = (pixel / 256) * 16;
-	int sy = pixel % 256;
+	int y, x0, x1;
+
+	for (y = 0; y < DISPLAY_HEIGHT; y++) {
+		if (0 == memcmp(frame_shown[y], bitmap[y], sizeof(frame_shown[y])))
+			continue;
+		for (x0 = 0; frame_shown[y][x0] == bitmap[y][x0]; x0++)
+			;
+		for (x1 = DISPLAY_VISIBLE_WORDS; frame_shown[y][x1-1] == bitmap[y][x1-1]; x1--)
+			;
+		memcpy(&frame_shown[y][x0], &bitmap[y][x0], (x1 - x0) * sizeof(uint16_t));
+		sdl_expand_line(y, x0, x1, bitmap[y]);
+	}
+}
 
-	if (x < 0 || y < 0 || y >= DISPLAY_HEIGHT || x >= DISPLAY_WIDTH)
-		return -1;
+/**
+ * @brief run the emulation, then let the video thread know it is done
+ *
+ * fatal() on this thread returns here, so that the main thread can
+ * shut down SDL and the MNG recording after the video thread is done.
+ *
+ * @param arg argument for the emulation function
+ * @result returns the emulation function's result, or -1 after fatal()
+ */
+static int sdl_emulator(void *arg)
+{
+	volatile int res = -1;
+
+	__atomic_store_n(&emulator_id, SDL_ThreadID(), __ATOMIC_RELEASE);
+	if (0 == setjmp(emulator_fatal))
+		res = (*render_emulate)(arg);
+
+	__atomic_store_n(&emulator_done, 1, __ATOMIC_RELEASE);
+	render_wakeup();
+	return res;
+}
+
+/**
+ * @brief video thread loop: events, drawing commands, and frames
+ *
+ * The loop wakes up when the emulator publishes a frame, and at least
+ * every 10ms to poll the SDL events.
+ */
+static void sdl_render(void)
+{
+	sdl_cmd_t cmd;
+	SDL_Event ev;
+	int done;
+
+	do {
+		done = __atomic_load_n(&emulator_done, __ATOMIC_ACQUIRE);
+		SDL_SemWaitTimeout(render_sem, 10);
+		while (SDL_PollEvent(&ev)) {
+			if (sdl_window_event(&ev))
+				event_put(&ev);
+		}
+		sdl_grab_keys();
+		while (cmd_get(&cmd))
+			sdl_execute(&cmd);
+		if (frame_take()) {
+			sdl_show_frame(frame_buff[frame_front]);
+			sdl_present();
+		}
+	} while (!done);
+}
 
-	if (-1 == minx || x < minx)
-		minx = x;
-	if (-1 == maxx || (x + 16) > maxx)
-		maxx = x + 16;
-	if (-1 == miny || y < miny)
-		miny = y;
-	if (-1 == maxy || (y + 1) > maxy)
-		maxy = y + 1;
-
-	sdl_blit(alto, pixels, x, y, sx, sy, 16, 1);
-	if (!dbg.visible) {
-		sdl_blit(screen, pixels, x + BORDER_X, y + BORDER_Y,
-			sx, sy, 16, 1);
+/**
+ * @brief halt the emulator thread and wait until it is done
+ *
+ * This is for fatal() on a thread other than the emulator's, so that
+ * exit() does not flush the drives or quit SDL under the running
+ * emulator. The video thread keeps draining the command queue, which
+ * the emulator might be waiting on, and then joins the emulator thread.
+ */
+static void render_stop(void)
+{
+	int video = SDL_ThreadID() == render_id;
+	sdl_cmd_t cmd;
+
+	__atomic_store_n(&halted, 1, __ATOMIC_RELEASE);
+	while (!__atomic_load_n(&emulator_done, __ATOMIC_ACQUIRE)) {
+		if (video)
+			while (cmd_get(&cmd))
+				;
+		SDL_Delay(1);
 	}
-	return 0;
+	if (video) {
+		SDL_WaitThread(emulator_thread, NULL);
+		emulator_thread = NULL;
+		render_active = 0;
+	}
+}
+
+/**
+ * @brief run the emulation on its own thread, while this thread presents
+ *
+ * SDL wants video output and events on the thread that set the video
+ * mode, so the calling (main) thread becomes the video thread.
+ *
+ * @param emulate function running the emulation until halted
+ */
+static void sdl_run(int (*emulate)(void *))
+{
+	render_sem = SDL_CreateSemaphore(0);
+	if (NULL == render_sem)
+		fatal(1, "SDL_CreateSemaphore() failed\n");
+	render_id = SDL_ThreadID();
+	render_emulate = emulate;
+	memcpy(frame_shown, dsp.raw_bitmap, sizeof(frame_shown));
+	render_active = 1;
+
+	emulator_thread = SDL_CreateThread(sdl_emulator, NULL);
+	if (NULL == emulator_thread) {
+		render_active = 0;
+		fatal(1, "SDL_CreateThread() failed\n");
+	}
+	sdl_render();
+	SDL_WaitThread(emulator_thread, NULL);
+	emulator_thread = NULL;
+
+	render_active = 0;
+	SDL_DestroySemaphore(render_sem);
+	render_sem = NULL;
 }
+#endif	/* RENDER_THREAD */
 
 /**
  * @brief count the bits at and around a bit at a charmap
@@ -884,14 +1869,15 @@ int sdl_chargen_alpha(const chargen_t *cg, int col, uint32_t rgb)
 }
 
 /**
- * @brief write a character to the SDL debug surface
+ * @brief write a character cell to the SDL debug surface (video thread)
  *
  * @param x x coordinate where to write the word
  * @param y y coordinate where to write the word
  * @param ch character code to write
+ * @param color color index, ored with 8 to highlight
  * @result 0 on success, -1 on error
  */
-int sdl_debug(int x, int y, int ch, int color)
+static int sdl_debug_cell(int x, int y, int ch, int color)
 {
 	int sx = ch * DBG_FONT_W;
 	int sy = (color % DBG_COLORS) * DBG_FONT_H;
@@ -914,7 +1900,7 @@ int sdl_debug(int x, int y, int ch, int color)
 		SDL_FillRect(debug, &dr, SDL_MapRGB(debug->format,BACKGROUND_RGB));
 	}
 	SDL_BlitSurface(charmap, &sr, debug, &dr);
-	if (dbg.visible) {
+	if (view) {
 		sr.x = dr.x;
 		sr.y = dr.y;
 		dr.x = BORDER_X + x;
@@ -924,13 +1910,56 @@ int sdl_debug(int x, int y, int ch, int color)
 	return 0;
 }
 
+/**
+ * @brief write a character to the SDL debug surface
+ *
+ * @param x x coordinate where to write the word
+ * @param y y coordinate where to write the word
+ * @param ch character code to write
+ * @param color color index, ored with 8 to highlight
+ * @result 0 on success, -1 on error
+ */
+int sdl_debug(int x, int y, int ch, int color)
+{
+	return sdl_command(cmd_debug, x, y, ch, color);
+}
+
+/**
+ * @brief execute a drawing command (video thread)
+ *
+ * @param cmd pointer to the command
+ */
+static void sdl_execute(const sdl_cmd_t *cmd)
+{
+	switch (cmd->op) {
+	case cmd_putch:
+		sdl_putch(cmd->x, cmd->y, cmd->a);
+		break;
+	case cmd_icon:
+		sdl_icon(cmd->x, cmd->y, cmd->a);
+		break;
+	case cmd_debug:
+		sdl_debug_cell(cmd->x, cmd->y, cmd->a, cmd->b);
+		break;
+	case cmd_view:
+		sdl_view(cmd->a);
+		break;
+	}
+}
 
 /**
  * @brief shut down SDL
  */
 static void sdl_exit(void)
 {
+#if	RENDER_THREAD
+	/* exit() on the emulator thread: leave SDL to the video thread */
+	if (render_active && SDL_ThreadID() != render_id)
+		return;
+#endif
 	screenmng_stop();
+	if (shot_at_exit)
+		screenshot(NULL);
 	sdl_close_display();
 	SDL_Quit();
 }
@@ -1014,10 +2043,11 @@ static int sdl_open_display(int width, int height, int depth, const char *title)
  */
 static int sdl_init(int width, int height, int depth, const char *title)
 {
+#if	FRONTEND_ICONS
 	int n, x, y;
+#endif
 	SDL_Rect dst;
 	uint32_t rmask, gmask, bmask, amask;
-	uint32_t colors[2];
 
 	SDL_Init(SDL_INIT_VIDEO | SDL_INIT_NOPARACHUTE);
 	atexit(sdl_exit);
@@ -1059,12 +2089,6 @@ static int sdl_init(int width, int height, int depth, const char *title)
 	if (NULL == alto)
 		return -1;
 
-	/* create a 16x256xdepth surface as blit source for words */
-	pixels = SDL_CreateRGBSurface(SDL_HWSURFACE | SDL_ASYNCBLIT,
-		16*256, 256, depth, rmask, gmask, bmask, amask);
-	if (NULL == pixels)
-		return -1;
-
 	debug = SDL_CreateRGBSurface(SDL_HWSURFACE | SDL_ASYNCBLIT,
 		width, height, depth, rmask, gmask, bmask, amask);
 	if (NULL == debug)
@@ -1089,8 +2113,8 @@ static int sdl_init(int width, int height, int depth, const char *title)
 	dst.w = width;
 	dst.h = height;
 
-	colors[0] = SDL_MapRGB(alto->format,BACKGROUND_RGB);
-	colors[1] = SDL_MapRGB(alto->format,FOREGROUND_RGB);
+	alto_bg = SDL_MapRGB(alto->format,BACKGROUND_RGB);
+	alto_fg = SDL_MapRGB(alto->format,FOREGROUND_RGB) ^ alto_bg;
 
 	SDL_SetClipRect(alto, &dst);
 	SDL_FillRect(alto, NULL, SDL_MapRGB(alto->format,BACKGROUND_RGB));
@@ -1098,23 +2122,6 @@ static int sdl_init(int width, int height, int depth, const char *title)
 	SDL_SetClipRect(debug, &dst);
 	SDL_FillRect(debug, NULL, SDL_MapRGB(debug->format,BACKGROUND_RGB));
 
-	dst.w = 1;
-	dst.h = 1;
-	for (y = 0; y < 256; y++) {
-		dst.y = y;
-		for (x = 0; x < 256; x++) {
-			dst.x = x * 16;
-			for (n = 0; n < 8; n++) {
-				SDL_FillRect(pixels, &dst, colors[(x >> (7-n)) & 1]);
-				dst.x += dst.w;
-			}
-			for (n = 0; n < 8; n++) {
-				SDL_FillRect(pixels, &dst, colors[(y >> (7-n)) & 1]);
-				dst.x += dst.w;
-			}
-		}
-	}
-
 #if	FRONTEND_ICONS
 	dst.w = 1;
 	dst.h = 1;
@@ -1167,6 +2174,139 @@ static int sdl_init(int width, int height, int depth, const char *title)
 	return 0;
 }
 
+#else	/* HEADLESS */
+
+/**
+ * @brief signal handler to shut down the simulation cleanly
+ *
+ * @param sig signal number
+ */
+static void headless_signal(int sig)
+{
+	halted = 1;
+}
+
+/**
+ * @brief headless: no border to print to
+ */
+static int sdl_print(int x, int y, const char *str)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: no border to write to
+ */
+int border_putch(int x, int y, uint8_t ch)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: no border to print to
+ */
+int border_printf(int x, int y, const char *fmt, ...)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: the debugger view is never shown
+ *
+ * @param which which surface to draw to screen (0 Alto, else debug)
+ */
+void debug_view(int which)
+{
+	dbg.visible = 0;
+}
+
+/**
+ * @brief headless: count frames, but poll no events
+ *
+ * @param full set to non zero, if a full frame update was done
+ * @result 0 on success
+ */
+int sdl_update(int full)
+{
+	if (full)
+		frame_done();
+	return 0;
+}
+
+/**
+ * @brief headless: nothing to refresh
+ *
+ * @param full set to non zero, if a full frame update was done
+ * @result 0 on success
+ */
+int sdl_refresh(int full)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: there are no LED icons
+ */
+int sdl_draw_icon(int x, int y, int type)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: nothing to draw
+ *
+ * The display code keeps dsp.raw_bitmap and dsp.dirty_words up to
+ * date, which is all that screenshots and MNG frames are made from.
+ *
+ * @param y scanline number
+ * @param x0 first word to write
+ * @param x1 last word to write + 1
+ * @param words pointer to the words of the scanline (raw_bitmap[y])
+ * @result 0 on success, -1 on error
+ */
+int sdl_write_line(int y, int x0, int x1, const uint16_t *words)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: no debugger font
+ */
+int sdl_chargen_alpha(const chargen_t *cg, int col, uint32_t rgb)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: no debugger surface
+ */
+int sdl_debug(int x, int y, int ch, int color)
+{
+	return 0;
+}
+
+/**
+ * @brief headless: finish recordings and screenshots
+ */
+static void sdl_exit(void)
+{
+	screenmng_stop();
+	if (shot_at_exit)
+		screenshot(NULL);
+}
+
+/**
+ * @brief headless: no video; just stop cleanly on SIGINT and SIGTERM
+ */
+static int sdl_init(int width, int height, int depth, const char *title)
+{
+	atexit(sdl_exit);
+	signal(SIGINT, headless_signal);
+	signal(SIGTERM, headless_signal);
+	return 0;
+}
+#endif	/* HEADLESS */
+
 /**
  * @brief print fatal error and exit(exitcode)
  *
@@ -1182,6 +2322,18 @@ void fatal(int exitcode, const char *fmt, ...)
 	va_end(ap);
 	fflush(stderr);
 
+#if	RENDER_THREAD
+	if (render_active) {
+		/* on the emulator thread: stop it, and let main() exit */
+		if (SDL_ThreadID() == __atomic_load_n(&emulator_id, __ATOMIC_ACQUIRE)) {
+			emulator_exitcode = exitcode;
+			__atomic_store_n(&halted, 1, __ATOMIC_RELEASE);
+			longjmp(emulator_fatal, 1);
+		}
+		/* on another thread: the emulator must be done before exit() */
+		render_stop();
+	}
+#endif
 	exit(exitcode);
 }
 
@@ -1200,23 +2352,85 @@ static void usage(int argc, char **argv)
 	printf("usage: %s [options] binary_image\n", exe);
 	printf("options can be one or more of\n");
 	dbg_usage(argc, argv);
+	cpu_usage(argc, argv);
 	drive_usage(argc, argv);
 	ether_usage(argc, argv);
 	printf("-dc		dump (Alto) core to file 'alto.dump' at exit\n");
 	printf("-kr		report unkown/unhandled key press (to stderr)\n");
 	printf("-b key		set a boot key (5,4,6,e,7,d,u,v,0,k,-,p,/,\\,lf,bs)\n");
 	printf("-d		start in paused mode and debug view\n");
+	printf("-fr=n		exit after n frames\n");
+	printf("-ss		save a PNG screenshot at exit\n");
+	printf("-mng		record the screen to 'alto.mng' from the start\n");
+	printf("-mz=n		MNG compression level (0 to 9, default 5)\n");
+	printf("-mq=n		queue up to n MNG frames for the encoders (default 8)\n");
+	printf("-mt=n		use n MNG encoder threads (default 2)\n");
 	printf("-h		display this help\n");
 	exit(0);
 }
 
 
+/**
+ * @brief run the emulation until halted
+ *
+ * Loops polling for timer events and executing CPU time slices.
+ * With RENDER_THREAD this is the emulator thread's function.
+ *
+ * @param arg unused
+ * @result 0
+ */
+static int alto_run(void *arg)
+{
+#if	DEBUG
+	while (!__atomic_load_n(&halted, __ATOMIC_ACQUIRE)) {
+		ntime_t run, ran;
+		while ((run = timer_next_time()) < CPU_MICROCYCLE_TIME)
+			timer_fire();
+		if (run <= 0 || run > CPU_MICROCYCLE_TIME)
+			run = CPU_MICROCYCLE_TIME;
+
+		global_ntime += run;
+		ran = alto_execute(run);
+		global_ntime += ran - run;
+
+		if (dbg.visible && ll[cpu.task].level > 0) {
+			dbg_dump_regs();
+			sdl_refresh(0);
+		}
+		step = 0;
+		/* In debug mode update often, so we can easily break out of SDL */
+		while (__atomic_load_n(&paused, __ATOMIC_ACQUIRE) && !step &&
+			!__atomic_load_n(&halted, __ATOMIC_ACQUIRE)) {
+			dbg_dump_regs();
+			sdl_refresh(0);
+		}
+	}
+#else
+	while (!__atomic_load_n(&halted, __ATOMIC_ACQUIRE)) {
+		ntime_t run, ran;
+		while ((run = timer_next_time()) < CPU_MICROCYCLE_TIME)
+			timer_fire();
+		if (run <= 0)
+			run = 5000 * CPU_MICROCYCLE_TIME;
+		global_ntime += run;
+		ran = alto_execute(run);
+		global_ntime += ran - run;
+		while (__atomic_load_n(&paused, __ATOMIC_ACQUIRE) &&
+			!__atomic_load_n(&halted, __ATOMIC_ACQUIRE)) {
+			/* no field is emulated: refresh, but count no frame */
+			dbg_dump_regs();
+			sdl_refresh(1);
+		}
+	}
+#endif
+	return 0;
+}
+
 /**
  * @brief Salto main entry
  *
  * Initializes the SDL window, loads (P)ROM images, intializes the
- * various subsystems and goes into a loop polling for timer events
- * and executing CPU time slices.
+ * various subsystems and runs the emulation.
  *
  * @param argc argument count
  * @param argv array of argument strings
@@ -1248,7 +2462,9 @@ int main(int argc, char **argv)
 
 			} else
 #endif
-			if (0 == ether_args(argv[i])) {
+			if (0 == cpu_args(argv[i])) {
+				/* CPU accepted the switch */
+			} else if (0 == ether_args(argv[i])) {
 				/* ethernet accepted the switch */
 			} else if (0 == drive_args(argv[i])) {
 				/* drive code accepted the switch */
@@ -1256,6 +2472,18 @@ int main(int argc, char **argv)
 				dump = 1;	/* dump core at exit */
 			} else if (!strcmp(argv[i], "-kr")) {
 				report_key = 1;	/* report unknown keys */
+			} else if (!strncmp(argv[i], "-fr=", 4)) {
+				frames_max = strtol(argv[i] + 4, NULL, 0);
+			} else if (!strcmp(argv[i], "-ss")) {
+				shot_at_exit = 1;	/* screenshot at exit */
+			} else if (!strcmp(argv[i], "-mng")) {
+				mng_at_start = 1;	/* record MNG from the start */
+			} else if (!strncmp(argv[i], "-mz=", 4)) {
+				mng_level = strtol(argv[i] + 4, NULL, 0);
+			} else if (!strncmp(argv[i], "-mq=", 4)) {
+				mng_depth = strtol(argv[i] + 4, NULL, 0);
+			} else if (!strncmp(argv[i], "-mt=", 4)) {
+				mng_threads = strtol(argv[i] + 4, NULL, 0);
 			} else if (!strcmp(argv[i], "-d")) {
 				paused = 1;	/* start paused */
 				step = 0;	/* don't step */
@@ -1279,45 +2507,16 @@ int main(int argc, char **argv)
 	}
 	drive_select(0, 0);
 	alto_reset();
-
-#if	DEBUG
-	while (!halted) {
-		ntime_t run, ran;
-		while ((run = timer_next_time()) < CPU_MICROCYCLE_TIME)
-			timer_fire();
-		if (run <= 0 || run > CPU_MICROCYCLE_TIME)
-			run = CPU_MICROCYCLE_TIME;
-
-		global_ntime += run;
-		ran = alto_execute(run);
-		global_ntime += ran - run;
-
-		if (dbg.visible && ll[cpu.task].level > 0) {
-			dbg_dump_regs();
-			sdl_update(0);
-		}
-		step = 0;
-		/* In debug mode update often, so we can easily break out of SDL */
-		while (paused && !step && !halted) {
-			dbg_dump_regs();
-			sdl_update(0);
-		}
-	}
+	if (mng_at_start)
+		screenmng_start();
+
+#if	RENDER_THREAD
+	sdl_run(alto_run);
+	/* fatal() on the emulator thread: shut down here */
+	if (emulator_exitcode >= 0)
+		return emulator_exitcode;
 #else
-	while (!halted) {
-		ntime_t run, ran;
-		while ((run = timer_next_time()) < CPU_MICROCYCLE_TIME)
-			timer_fire();
-		if (run <= 0)
-			run = 5000 * CPU_MICROCYCLE_TIME;
-		global_ntime += run;
-		ran = alto_execute(run);
-		global_ntime += ran - run;
-		while (paused && !halted) {
-			dbg_dump_regs();
-			sdl_update(1);
-		}
-	}
+	alto_run(NULL);
 #endif
 	if (dump) {
 		FILE *fp;
@@ -34,80 +34,327 @@
 
 #define	DEBUG_TIMER	0
 
+/** @brief number of children per node in the timer heaps */
+#define	TIMER_HEAP_D	4
+
+/** @brief number of bits of a timer id used for the slot number */
+#define	TIMER_SLOT_BITS	16
+
+/** @brief mask for the slot number of a timer id */
+#define	TIMER_SLOT_MASK	((1 << TIMER_SLOT_BITS) - 1)
+
+
+/** @brief timer_sync_cycle value if no synchronous timer is pending */
+#define	TIMER_NEVER	((ntime_t)1 << 62)
+
 /** @brief total nano seconds */
 ntime_t global_ntime;
 
+/** @brief cycle number before which the next synchronous timer fires */
+ntime_t timer_sync_cycle = TIMER_NEVER;
+
+/** @brief timer queues */
+typedef enum {
+	tq_async,	/**< timers that end the CPU timeslice */
+	tq_sync,	/**< timers fired by alto_execute() inside the timeslice */
+	tq_COUNT
+}	timer_queue_t;
+
 /** @brief Structure of a timer (running in the simulated time domain) */
-typedef struct atimer_s {
-	/* next timer in atime order */
-	struct atimer_s *next;
-	/* id of this timer */
-	int id;
+typedef struct {
 	/* nano time when timer is due to fire */
 	ntime_t atime;
+	/* insertion sequence number; later inserted timers fire first on equal atime */
+	ntime_t seq;
+	/* id of this timer; 0 if the slot is free or the timer was removed */
+	timer_id_t id;
+	/* generation of this slot, incremented whenever an id becomes invalid */
+	uint32_t gen;
+	/* queue of this timer (timer_queue_t) */
+	int queue;
+	/* index into the queue's heap, -1 if not pending */
+	int pos;
+	/* next free slot */
+	int next;
 	/* callback to call when firing */
-	void (*callback)(int id, int arg);
+	void (*callback)(timer_id_t id, int arg);
 	/* argument to callback */
 	int arg;
 	/* argument to callback */
 	const char *name;
 }	atimer_t;
 
+/** @brief d-ary heap of slot numbers of pending timers, ordered by atime */
+typedef struct {
+	/* slot numbers */
+	int *heap;
+	/* number of entries */
+	int count;
+}	timer_heap_t;
+
+/** @brief timer slots; slot 0 is unused, so that no timer id is 0 */
+static atimer_t *timer_slot;
+
+/** @brief number of allocated timer slots */
+static int timer_slots;
+
+/** @brief first free timer slot, 0 if none */
+static int timer_free;
 
-/** @brief linked list of free timer resources */
-static atimer_t *timer_free;
+/** @brief pending timers per queue */
+static timer_heap_t timer_queue[tq_COUNT];
 
-/** @brief linked list of pending timer events */
-static atimer_t *timer_head;
+/** @brief slot of the timer whose callback is running, 0 if none */
+static int timer_firing;
 
-/** @brief next timer id */
-static int timer_id;
+/** @brief insertion sequence counter */
+static ntime_t timer_seq;
+
+/** @brief return non-zero if timer slot a is due before timer slot b */
+#define	TIMER_BEFORE(a,b) \
+	(timer_slot[a].atime < timer_slot[b].atime || \
+	(timer_slot[a].atime == timer_slot[b].atime && \
+	 timer_slot[a].seq > timer_slot[b].seq))
+
+/**
+ * @brief return the slot number for a timer id, 0 if the id is invalid
+ *
+ * @param id timer id
+ * @result slot number
+ */
+static int timer_lookup(timer_id_t id)
+{
+	int slot = (int)(id & TIMER_SLOT_MASK);
+
+	if (id <= 0 || slot >= timer_slots || timer_slot[slot].id != id)
+		return 0;
+	return slot;
+}
 
 /**
- * @brief allocate a new timer resource, or use one from the free list
+ * @brief allocate a new timer slot, or use one from the free list
  *
- * @returns pointer to a atimer_t, zeroed
+ * @returns slot number, or 0 if out of memory
  */
-static atimer_t *timer_alloc (void)
+static int timer_alloc(void)
 {
-	atimer_t *atimer = timer_free;
+	atimer_t *atimer;
+	int slot = timer_free;
 
-	if (atimer) {
-		timer_free = atimer->next;
+	if (slot) {
+		timer_free = timer_slot[slot].next;
 	} else {
-		atimer = malloc(sizeof(atimer_t));
+		int i, q, size = timer_slots ? 2 * timer_slots : 64;
+
+		if (size > TIMER_SLOT_MASK + 1)
+			return 0;
+		atimer = realloc(timer_slot, size * sizeof(atimer_t));
 		if (!atimer)
-			return NULL;
+			return 0;
+		timer_slot = atimer;
+		for (q = 0; q < tq_COUNT; q++) {
+			int *heap = realloc(timer_queue[q].heap, size * sizeof(int));
+			if (!heap)
+				return 0;
+			timer_queue[q].heap = heap;
+		}
+		memset(&timer_slot[timer_slots], 0,
+			(size - timer_slots) * sizeof(atimer_t));
+		/* chain the new slots (except slot 0) to the free list */
+		for (i = size - 1; i > timer_slots && i > 1; i--) {
+			timer_slot[i].next = timer_free;
+			timer_free = i;
+		}
+		slot = timer_slots ? timer_slots : 1;
+		timer_slots = size;
 	}
-	memset(atimer, 0, sizeof (atimer_t));
-	return atimer;
+	atimer = &timer_slot[slot];
+	/* a 32 bit generation: a stale id matches again only after 2^32 reuses */
+	atimer->gen++;
+	atimer->id = ((timer_id_t)atimer->gen << TIMER_SLOT_BITS) | slot;
+	atimer->pos = -1;
+	return slot;
 }
 
 /**
- * @brief free a timer by inserting it to the head of the free list
+ * @brief free a timer slot by inserting it to the head of the free list
  *
- * @param atimer pointer to a atimer_t struct
+ * @param slot slot number
  */
-static void timer_release(atimer_t *atimer)
+static void timer_release(int slot)
 {
-	LOG((log_TMR,5,"release timer id:%d (%s)\n",
-		atimer->id, atimer->name));
+	atimer_t *atimer = &timer_slot[slot];
+
+	LOG((log_TMR,5,"release timer id:%lld (%s)\n",
+		(long long)atimer->id, atimer->name));
 	atimer->id = 0;
+	atimer->pos = -1;
 	atimer->next = timer_free;
-	timer_free = atimer;
+	timer_free = slot;
+}
+
+/**
+ * @brief move the timer at heap index pos up to its place
+ *
+ * @param q pointer to the heap
+ * @param pos heap index
+ */
+static void timer_sift_up(timer_heap_t *q, int pos)
+{
+	int slot = q->heap[pos];
+
+	while (pos > 0) {
+		int parent = (pos - 1) / TIMER_HEAP_D;
+		if (!TIMER_BEFORE(slot, q->heap[parent]))
+			break;
+		q->heap[pos] = q->heap[parent];
+		timer_slot[q->heap[pos]].pos = pos;
+		pos = parent;
+	}
+	q->heap[pos] = slot;
+	timer_slot[slot].pos = pos;
+}
+
+/**
+ * @brief move the timer at heap index pos down to its place
+ *
+ * @param q pointer to the heap
+ * @param pos heap index
+ */
+static void timer_sift_down(timer_heap_t *q, int pos)
+{
+	int slot = q->heap[pos];
+
+	for (;;) {
+		int child = pos * TIMER_HEAP_D + 1;
+		int last = child + TIMER_HEAP_D;
+		int best = -1;
+
+		if (last > q->count)
+			last = q->count;
+		for (; child < last; child++)
+			if (best < 0 || TIMER_BEFORE(q->heap[child], q->heap[best]))
+				best = child;
+		if (best < 0 || !TIMER_BEFORE(q->heap[best], slot))
+			break;
+		q->heap[pos] = q->heap[best];
+		timer_slot[q->heap[pos]].pos = pos;
+		pos = best;
+	}
+	q->heap[pos] = slot;
+	timer_slot[slot].pos = pos;
+}
+
+/**
+ * @brief update timer_sync_cycle from the first synchronous timer
+ *
+ * A timer fires before the first cycle starting less than one
+ * microcycle before its atime.
+ */
+static void timer_sync_update(void)
+{
+	timer_heap_t *q = &timer_queue[tq_sync];
+
+	if (q->count > 0)
+		timer_sync_cycle = timer_slot[q->heap[0]].atime / CPU_MICROCYCLE_TIME;
+	else
+		timer_sync_cycle = TIMER_NEVER;
+}
+
+/**
+ * @brief remove the first timer from a heap
+ *
+ * @param q pointer to the heap
+ * @result slot number of the timer
+ */
+static int timer_pop(timer_heap_t *q)
+{
+	int slot = q->heap[0];
+
+	timer_slot[slot].pos = -1;
+	if (--q->count > 0) {
+		q->heap[0] = q->heap[q->count];
+		timer_sift_down(q, 0);
+	}
+	if (q == &timer_queue[tq_sync])
+		timer_sync_update();
+	return slot;
+}
+
+/**
+ * @brief return the first pending timer of a heap, dropping removed timers
+ *
+ * timer_remove() only marks a timer as removed; it is released
+ * when it becomes the first timer.
+ *
+ * @param q pointer to the heap
+ * @result slot number, or 0 if no timer is pending
+ */
+static int timer_first(timer_heap_t *q)
+{
+	while (q->count > 0) {
+		int slot = q->heap[0];
+		if (timer_slot[slot].id)
+			return slot;
+		timer_pop(q);
+		timer_release(slot);
+	}
+	return 0;
+}
+
+/**
+ * @brief (re)insert a timer slot into its heap
+ *
+ * @param slot slot number
+ * @param atime time offset from now, ntime(), when the timer should fire
+ */
+static void timer_schedule(int slot, ntime_t atime)
+{
+	atimer_t *this = &timer_slot[slot];
+	timer_heap_t *q = &timer_queue[this->queue];
+
+	if (atime < 0)
+		fatal(3, "negative time (%lld)\n", atime);
+	atime += ntime();
+
+	this->atime = atime;
+	this->seq = ++timer_seq;
+	if (this->pos < 0) {
+		this->pos = q->count++;
+		q->heap[this->pos] = slot;
+	}
+	timer_sift_up(q, this->pos);
+	timer_sift_down(q, this->pos);
+
+	if (this->queue == tq_sync) {
+		/* alto_execute() checks timer_sync_cycle every cycle */
+		timer_sync_update();
+	} else if (atime <= global_ntime) {
+		/*
+		 * This timer fires before the CPU timeslice ends, so it
+		 * is the first pending timer that is not removed.
+		 * Set a flag so that alto_execute() leaves the loop
+		 */
+		alto_leave = 1;
+		LOG((log_TMR,3,"@%lld: inserting '%s' @%lld <= %lld\n",
+			ntime(), this->name, atime, global_ntime));
+	}
 }
 
 /**
- * @brief return time of the next timer event, -1 if none
+ * @brief return time of the next timer event that ends a CPU timeslice, -1 if none
+ *
+ * Synchronous timers are fired by alto_execute() and are not considered.
  *
  * @result time in nano seconds
  */
 ntime_t timer_next_time(void)
 {
-	atimer_t *head = timer_head;
+	int slot = timer_first(&timer_queue[tq_async]);
 	ntime_t next;
 
-	if (head) {
+	if (slot) {
+		atimer_t *head = &timer_slot[slot];
 		next = head->atime - ntime();
 		LOG((log_TMR,5,"next timer %s(%d,%d) fires @ %+lld ns\n",
 			head->name, head->id, head->arg, next));
@@ -118,128 +365,185 @@ ntime_t timer_next_time(void)
 	return next;
 }
 
+/**
+ * @brief qsort() helper to sort timer slot numbers by due time
+ *
+ * @param a pointer to a slot number
+ * @param b pointer to another slot number
+ * @result -1, 0, or +1
+ */
+static int timer_compare(const void *a, const void *b)
+{
+	int sa = *(const int *)a, sb = *(const int *)b;
+
+	if (TIMER_BEFORE(sa, sb))
+		return -1;
+	if (TIMER_BEFORE(sb, sa))
+		return +1;
+	return 0;
+}
+
 /**
  * @brief peek at then n'th timer, return its name and set *atime
  *
+ * This sorts a copy of the heaps, so it is meant for the debugger only.
+ *
  * @param n peek at the n'th timer
- * @param id pointer to int receiving the id of the timer
+ * @param id pointer to a timer_id_t receiving the id of the timer
  * @param arg pointer to int receiving the argument for the timer callback
  * @param atime put the n'ths timer's atime here
  * @result name of the timer, NULL if none
  */
-const char *timer_peek(int n, int *id, int *arg, ntime_t *atime)
+const char *timer_peek(int n, timer_id_t *id, int *arg, ntime_t *atime)
 {
-	atimer_t *head = timer_head;
+	static int *sorted;
+	static int size;
+	atimer_t *this;
+	int i, q, count;
 
-	while (n > 0 && head) {
-		head = head->next;
-		n--;
-	}
-	if (head) {
-		*id = head->id;
-		*arg = head->arg;
-		*atime = head->atime;
-		return head->name;
+	if (size < timer_slots) {
+		int *tmp = realloc(sorted, timer_slots * sizeof(int));
+		if (!tmp)
+			return NULL;
+		sorted = tmp;
+		size = timer_slots;
 	}
-	return NULL;
+	for (q = 0, count = 0; q < tq_COUNT; q++)
+		for (i = 0; i < timer_queue[q].count; i++)
+			if (timer_slot[timer_queue[q].heap[i]].id)
+				sorted[count++] = timer_queue[q].heap[i];
+	if (n >= count)
+		return NULL;
+	qsort(sorted, count, sizeof(int), timer_compare);
+	this = &timer_slot[sorted[n]];
+	*id = this->id;
+	*arg = this->arg;
+	*atime = this->atime;
+	return this->name;
 }
 
 
 /**
  * @brief remove a timer by its id
  *
+ * The timer id becomes invalid at once; the slot is released when
+ * the timer would have become the first in its heap.
+ *
  * @param id timer id as returned by timer_insert()
  * @result 0 on success, -1 on error (id not found)
  */
-int timer_remove(int id)
+int timer_remove(timer_id_t id)
 {
-	atimer_t *this = timer_head, *last = NULL;
+	int slot = timer_lookup(id);
 
-	while (this && this->id != id) {
-		last = this;
-		this = last->next;
-	}
-	if (!this)
+	if (!slot || timer_slot[slot].pos < 0)
 		return -1;
 
-	if (last)
-		last->next = this->next;
-	else
-		timer_head = this->next;
-
-	timer_release(this);
+	timer_slot[slot].id = 0;
+	timer_slot[slot].gen++;
 
 	return 0;
 }
 
 /**
- * @brief insert a new timer
+ * @brief allocate and schedule a new timer
  *
+ * @param queue timer queue
  * @param atime time offset from now, ntime(), when the timer should fire
  * @param callback function to call at fire time
  * @param arg second argument to pass to the callback function
  * @param name name of the timer
- * @result timer id on success, -1 on error (negative time offset)
+ * @result timer id
  */
-int timer_insert(ntime_t atime, void (*callback)(int,int), int arg, const char *name)
+static timer_id_t timer_new(int queue, ntime_t atime, void (*callback)(timer_id_t,int), int arg, const char *name)
 {
-	atimer_t *head = timer_head;
-	atimer_t *last = NULL;
 	atimer_t *this;
+	int slot;
 
-	if (atime < 0)
-		fatal(3, "negative time (%lld)\n", atime);
-	atime += ntime();
-
-	this = timer_alloc();
-	if (!this)
+	slot = timer_alloc();
+	if (!slot)
 		fatal(3, "failed to allocated timer resources\n");
 
-	this->id = ++timer_id;
-	/* don't use 0 as a timer id, as 0 is used for "no timer" */
-	if (!timer_id)
-		this->id = ++timer_id;
-	this->atime = atime;
+	this = &timer_slot[slot];
+	this->queue = queue;
 	this->callback = callback;
 	this->arg = arg;
 	this->name = name;
-
-	while (head && atime > head->atime) {
-		last = head;
-		head = last->next;
-	}
-
-	if (last) {
-		this->next = last->next;
-		last->next = this;
-	} else {
-		this->next = timer_head;
-		timer_head = this;
-		if (atime <= global_ntime) {
-			/*
-			 * This timer is becoming first in the timer chain
-			 * and fires before the CPU timeslice ends.
-			 * Set a flag so that alto_execute() leaves the loop
-			 */
-			alto_leave = 1;
-			LOG((log_TMR,3,"@%lld: inserting '%s' @%lld <= %lld\n",
-				ntime(), name, atime, global_ntime));
-		}
-	}
+	timer_schedule(slot, atime);
 
 #if	DEBUG
 	LOG((log_TMR,7,"*************\n"));
-	head = timer_head;
-	while (head) {
-		LOG((log_TMR,7,"timer %p%s id:%d time:%lld callback:%p arg:%d\n",
-			head, head == this ? "*" : " ",
-			head->id, head->atime, head->callback, head->arg));
-		head = head->next;
+	{
+		timer_heap_t *q = &timer_queue[queue];
+		int i;
+		for (i = 0; i < q->count; i++) {
+			atimer_t *t = &timer_slot[q->heap[i]];
+			LOG((log_TMR,7,"timer %d%s id:%lld time:%lld callback:%p arg:%d\n",
+				q->heap[i], t == this ? "*" : " ",
+				(long long)t->id, t->atime, t->callback, t->arg));
+		}
 	}
 	LOG((log_TMR,7,"*************\n"));
 #endif
 
-	return timer_id;
+	return this->id;
+}
+
+/**
+ * @brief insert a new timer
+ *
+ * @param atime time offset from now, ntime(), when the timer should fire
+ * @param callback function to call at fire time
+ * @param arg second argument to pass to the callback function
+ * @param name name of the timer
+ * @result timer id on success, -1 on error (negative time offset)
+ */
+timer_id_t timer_insert(ntime_t atime, void (*callback)(timer_id_t,int), int arg, const char *name)
+{
+	return timer_new(tq_async, atime, callback, arg, name);
+}
+
+/**
+ * @brief insert a new timer that fires synchronous to the CPU
+ *
+ * The timer fires at the same time as one inserted with timer_insert(),
+ * but it does not end the CPU timeslice: alto_execute() fires it
+ * before executing the next cycle. This is meant for high frequency
+ * events like the disk bit clock.
+ *
+ * @param atime time offset from now, ntime(), when the timer should fire
+ * @param callback function to call at fire time
+ * @param arg second argument to pass to the callback function
+ * @param name name of the timer
+ * @result timer id on success, -1 on error (negative time offset)
+ */
+timer_id_t timer_insert_sync(ntime_t atime, void (*callback)(timer_id_t,int), int arg, const char *name)
+{
+	return timer_new(tq_sync, atime, callback, arg, name);
+}
+
+/**
+ * @brief reschedule a pending timer, or the timer whose callback is running
+ *
+ * The timer keeps its id, callback and queue. It is ordered as if it
+ * was removed and inserted again.
+ *
+ * @param id timer id as returned by timer_insert()
+ * @param atime time offset from now, ntime(), when the timer should fire
+ * @param arg new second argument to pass to the callback function
+ * @result timer id on success, -1 on error (id not found)
+ */
+timer_id_t timer_reschedule(timer_id_t id, ntime_t atime, int arg)
+{
+	int slot = timer_lookup(id);
+
+	if (!slot || (timer_slot[slot].pos < 0 && slot != timer_firing))
+		return -1;
+
+	timer_slot[slot].arg = arg;
+	timer_schedule(slot, atime);
+
+	return id;
 }
 
 /**
@@ -247,16 +551,23 @@ int timer_insert(ntime_t atime, void (*callback)(int,int), int arg, const char *
  *
  * @result timer id of timer that was fired, or -1 if none was due
  */
-int timer_fire(void)
+timer_id_t timer_fire(void)
 {
-	atimer_t *this = timer_head;
-	void (*callback)(int, int);
-	ntime_t atime;
-	int id, arg;
+	int async = timer_first(&timer_queue[tq_async]);
+	int sync = timer_first(&timer_queue[tq_sync]);
+	int slot = async;
+	atimer_t *this;
+	void (*callback)(timer_id_t, int);
+	ntime_t atime, acycle;
+	timer_id_t id;
+	int arg;
 
-	if (!this)
+	if (!slot || (sync && TIMER_BEFORE(sync, async)))
+		slot = sync;
+	if (!slot)
 		return -1;
 
+	this = &timer_slot[slot];
 	atime = this->atime - ntime();
 	if (atime >= CPU_MICROCYCLE_TIME)
 		return -1;
@@ -264,23 +575,30 @@ int timer_fire(void)
 	id = this->id;
 	arg = this->arg;
 	callback = this->callback;
-	timer_head = this->next;
+	timer_pop(&timer_queue[this->queue]);
 
-	LOG((log_TMR,5,"fire timer %p(%d,%d) @ %+lld ns\n",
-		callback, id, arg, atime));
+	LOG((log_TMR,5,"fire timer %p(%lld,%d) @ %+lld ns\n",
+		callback, (long long)id, arg, atime));
 
 	if (callback) {
 		/* leap forward in time to exact timer event */
+		acycle = alto_cycle;
 		global_ntime += atime;
+		alto_cycle = ntime() / CPU_MICROCYCLE_TIME;
+		timer_firing = slot;
 		(*callback)(id, arg);
+		timer_firing = 0;
 		/* back in time */
 		global_ntime -= atime;
+		alto_cycle = acycle;
 	} else {
-		LOG((log_TMR,0,"fire timer %p(%d,%d) @ %+lld ns - callback is NULL?\n",
-			callback, id, arg, atime));
+		LOG((log_TMR,0,"fire timer %p(%lld,%d) @ %+lld ns - callback is NULL?\n",
+			callback, (long long)id, arg, atime));
 	}
 
-	timer_release(this);
+	/* release the timer, unless the callback rescheduled it */
+	if (timer_slot[slot].pos < 0)
+		timer_release(slot);
 
 	return id;
 }
@@ -292,9 +610,21 @@ int timer_fire(void)
  */
 void timer_init(void)
 {
-	global_ntime = 0;
+	int q;
 
-	timer_free = NULL;
-	timer_head = NULL;
-	timer_id = 0;
+	global_ntime = 0;
+	alto_cycle = 0;
+
+	free(timer_slot);
+	timer_slot = NULL;
+	timer_slots = 0;
+	timer_free = 0;
+	for (q = 0; q < tq_COUNT; q++) {
+		free(timer_queue[q].heap);
+		timer_queue[q].heap = NULL;
+		timer_queue[q].count = 0;
+	}
+	timer_sync_cycle = TIMER_NEVER;
+	timer_firing = 0;
+	timer_seq = 0;
 }
@@ -45,12 +45,6 @@ typedef long lzwcode_t;
 /** @brief type to hold LZW characters (8 bits) */
 typedef unsigned char lzwchar_t;
 
-/** @brief set non-zero to debug the string stack (tons of log output) */
-#define	DEBUG_STACK	0
-
-/** @brief set non-zero to debug filling of the bit buffer */
-#define	DEBUG_BBUF	0
-
 /** @brief flags: compress (may be) ASCII */
 #define LZW_ASCII	(1 << 0)
 
@@ -72,8 +66,8 @@ typedef unsigned char lzwchar_t;
 /** @brief default (and max.) bits for compression */
 #define LZW_BITS	16
 
-/** @brief table size for string and stack */
-#define LZW_HSIZE	((1<<LZW_BITS)+3456)
+/** @brief table size for prefixes, suffixes and string lengths */
+#define LZW_HSIZE	(1<<LZW_BITS)
 
 /** @brief number of bits mask for for third byte of header */
 #define LZW_BIT_MASK	0x1f
@@ -103,24 +97,28 @@ typedef unsigned char lzwchar_t;
 #define	LZW_METHOD	LZW_BITS
 
 /** @brief prefix of code i */
-#define	LZW_PREFIXOF(i)	(z.codetab[i])
+#define	LZW_PREFIXOF(i)	(z->codetab[i])
 
 /** @brief suffix of code i */
-#define	LZW_SUFFIXOF(i)	((lzwchar_t *)z.htab)[i]
+#define	LZW_SUFFIXOF(i)	(z->htab[i])
 
-/** @brief stack bottom */
-#define	LZW_DE_STACK	((lzwchar_t *)&LZW_SUFFIXOF(1 << LZW_BITS))
-
-/** @brief stack top */
-#define	LZW_STACKTOP	((lzwchar_t *)&LZW_SUFFIXOF(LZW_HSIZE))
+/** @brief length of the string for code i */
+#define	LZW_LENGTHOF(i)	(z->lentab[i])
 
 /** @brief magic header of compressed files (compress) */
 static const lzwchar_t z_magic[2] = {0037, 0235};
 
-static const lzwchar_t rmask[9] = {0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff};
-
 /** @brief structure of a compressed stream */
-typedef struct {
+struct zstream_s {
+	/** @brief stream type (1: compress, 2: gzip) */
+	int type;
+
+	/** @brief zlib stream for type 2 */
+	z_stream d;
+
+	/** @brief non-zero after the first LZW code was output */
+	int started;
+
 	/** @brief input pointer */
 	uint8_t *ip;
 
@@ -142,6 +140,9 @@ typedef struct {
 	/** @brief set by getcode() if end of input is reached */
 	int eof;
 
+	/** @brief set if the input is corrupt */
+	int error;
+
 	/** @brief flag set non-zero when a clear code is found */
 	int clear;
 
@@ -160,15 +161,24 @@ typedef struct {
 	/** @brief string of suffixes */
 	lzwchar_t htab[LZW_HSIZE];
 
-	/** @brief code prefix table and stack */
-	lzwcode_t codetab[LZW_HSIZE];
+	/** @brief code prefix table */
+	uint16_t codetab[LZW_HSIZE];
+
+	/** @brief string length table */
+	uint16_t lentab[LZW_HSIZE];
+
+	/** @brief string that did not fit into the output buffer */
+	lzwchar_t strbuf[LZW_HSIZE];
+
+	/** @brief read offset into strbuf */
+	size_t pend;
+
+	/** @brief number of bytes in strbuf */
+	size_t plen;
 
 	/** @brief block compression parameters */
 	int block;
 
-	/** @brief stack pointer */
-	lzwchar_t *sp;
-
 	/** @brief final character */
 	lzwcode_t final;
 
@@ -184,237 +194,346 @@ typedef struct {
 	/** @brief first free code */
 	lzwcode_t free;
 
-	/** @brief get code bit buffer */
-	lzwchar_t bbuf[LZW_BITS];
-
-	/** @brief get code buffer read offset (bits) */
-	int boffs;
+	/** @brief get code bit buffer (LSB first) */
+	uint64_t bbuf;
 
-	/** @brief get code buffer filled (bits) */
-	int bsize;
-}	zstate_t;
+	/** @brief number of bits in the bit buffer */
+	int bcnt;
 
-static zstate_t z;
+	/** @brief number of bits left in the current group of 8 codes */
+	int gleft;
+};
 
 
-static lzwcode_t getcode(void)
+/**
+ * @brief get the next LZW code from the input
+ *
+ * compress(1) writes codes in groups of 8, i.e. nbits bytes. When the
+ * code size changes, or after a clear code, the rest of the current
+ * group is padding and skipped.
+ *
+ * @param z pointer to the stream
+ * @result the next code, or -1 at end of input
+ */
+static lzwcode_t getcode(zstream_t *z)
 {
-	int boffs, bits, code;
-	lzwchar_t *bp;
+	lzwcode_t code;
 
-	if (z.eof)
+	if (z->eof)
 		return -1;
 
-	bp = z.bbuf;
-	if (z.clear || z.boffs >= z.bsize || z.free > z.max) {
-		if (z.free > z.max) {
+	if (z->clear || z->free > z->max) {
+		if (z->free > z->max) {
 			LOG((log_MISC,5,"FREE incode:%04x nbits:%d drop:%d i:%x o:%x\n",
-				z.incode, z.nbits, z.bsize - z.boffs,
-				(long)z.ioffs, (long)z.ooffs));
-			z.nbits++;
-			if (z.nbits >= z.bits)
-				z.max = z.maxmax;
+				z->incode, z->nbits, z->gleft,
+				(long)z->ioffs, (long)z->ooffs));
+			z->nbits++;
+			if (z->nbits >= z->bits)
+				z->max = z->maxmax;
 			else
-				z.max = LZW_MAXCODE(z.nbits);
+				z->max = LZW_MAXCODE(z->nbits);
 		}
-		if (z.clear) {
+		if (z->clear) {
 			LOG((log_MISC,5,"CLEAR incode:%04x nbits:%d drop:%d i:%x o:%x\n",
-				z.incode, z.nbits, z.bsize - z.boffs,
-				(long)z.ioffs, (long)z.ooffs));
-			z.max = LZW_MAXCODE(z.nbits = LZW_INIT_BITS);
-			z.clear = 0;
+				z->incode, z->nbits, z->gleft,
+				(long)z->ioffs, (long)z->ooffs));
+			z->max = LZW_MAXCODE(z->nbits = LZW_INIT_BITS);
+			z->clear = 0;
+		}
+
+		/* skip the rest of the group; it ends on a byte boundary */
+		if (z->gleft > z->bcnt) {
+			z->ioffs += (z->gleft - z->bcnt) >> 3;
+			z->bbuf = 0;
+			z->bcnt = 0;
+		} else {
+			z->bbuf >>= z->gleft;
+			z->bcnt -= z->gleft;
 		}
+		z->gleft = 0;
+	}
 
-		/* refill the bit buffer */
-		z.boffs = 0;
-		z.bsize = 0;
-		while (z.ioffs < z.isize && z.bsize < z.nbits) {
-			z.bbuf[z.bsize] = z.ip[z.ioffs];
-			z.bsize++;
-			z.ioffs++;
+	if (z->bcnt < z->nbits) {
+		/* refill the bit buffer a byte at a time, up to 56 bits or more */
+		while (z->bcnt <= 56 && z->ioffs < z->isize) {
+			z->bbuf |= (uint64_t)z->ip[z->ioffs++] << z->bcnt;
+			z->bcnt += 8;
 		}
-		if (z.bsize <= 0) {
-			z.eof = 1;
+		if (z->bcnt < z->nbits) {
+			z->eof = 1;
 			return -1;
 		}
-#if	DEBUG_BBUF
-		LOG((log_MISC,9,"BBUF nbits:%d i:%x o:%x (",
-			z.nbits, (long)z.ioffs, (long)z.ooffs));
-		for (boffs = 0; boffs < z.bsize; boffs++)
-			LOG((log_MISC,9,"%02x", z.bbuf[boffs]));
-		LOG((log_MISC,9,")\n"));
-#endif
-		/* round bit size down to integral number of code bits */
-		z.bsize = (z.bsize << 3) - (z.nbits - 1);
-	}
-
-	boffs = z.boffs;
-	bits = z.nbits;
-
-	/* point bp to the first byte */
-	bp += boffs >> 3;
-	boffs &= 7;
-	/* get low order bits */
-	code = *bp++ >> boffs;
-	bits -= (8 - boffs);
-	boffs = 8 - boffs;
-	/* get any 8 bit parts in the middle */
-	if (bits >= 8) {
-		code |= *bp++ << boffs;
-		boffs += 8;
-		bits -= 8;
-	}
-	/* get any high order bits */
-	code |= (*bp & rmask[bits]) << boffs;
-	z.boffs += z.nbits;
+	}
+
+	if (z->gleft <= 0)
+		z->gleft = z->nbits << 3;
+
+	code = (lzwcode_t)(z->bbuf & LZW_MAXCODE(z->nbits));
+	z->bbuf >>= z->nbits;
+	z->bcnt -= z->nbits;
+	z->gleft -= z->nbits;
 
 	return code;
 }
 
 /**
- * @brief uncompress a compress()d block of memory
+ * @brief initialize a stream to uncompress a compress()d block of memory
  *
- * @param op pointer to output buffer
- * @param osize number of bytes in output buffer
+ * @param z pointer to the stream
  * @param ip pointer to input buffer
  * @param isize number of bytes in input buffer
- * @result returns the size of the uncompressed data
+ * @result returns 0 on success, -1 on error
  */
-off_t z_copy(uint8_t *op, size_t osize, uint8_t *ip, size_t isize)
+static int lzw_init(zstream_t *z, uint8_t *ip, size_t isize)
 {
 	int flag;
 
-	memset(&z, 0, sizeof(z));
 	/* remember input pointer and size */
-	z.ip = ip;
-	z.isize = isize;
-
-	/* remember output pointer and size */
-	z.op = op;
-	z.osize = osize;
+	z->ip = ip;
+	z->isize = isize;
 
-	if (z.ioffs >= isize)
-		goto eof;
+	if (z->ioffs >= isize) {
+		z->eof = 1;
+		return 0;
+	}
 
 	/* skip magic header, if it is there */
 	if (!memcmp(ip, z_magic, sizeof(z_magic)))
-		z.ioffs += 2;
+		z->ioffs += 2;
 
-	if (z.ioffs >= isize)
-		goto eof;
+	if (z->ioffs >= isize) {
+		z->eof = 1;
+		return 0;
+	}
 
-	flag = z.ip[z.ioffs++];
+	flag = z->ip[z->ioffs++];
 	LOG((log_MISC,5,"flag: %#o (%#x)\n", flag, flag));
 
 	/* max bits in this image */
-	z.bits = flag & LZW_BIT_MASK;
-	z.block = flag & LZW_BLOCK_MASK;
-	z.max = LZW_MAXCODE(z.nbits = LZW_INIT_BITS);
-	z.maxmax = 1ll << z.bits;
-	z.free = z.block ? LZW_FIRST_CODE : 256;
+	z->bits = flag & LZW_BIT_MASK;
+	z->block = flag & LZW_BLOCK_MASK;
+	z->max = LZW_MAXCODE(z->nbits = LZW_INIT_BITS);
+	z->maxmax = 1ll << z->bits;
+	z->free = z->block ? LZW_FIRST_CODE : 256;
 
-	if (z.bits > LZW_BITS) {
+	if (z->bits > LZW_BITS) {
 		errno = EFTYPE;
-		LOG((log_MISC,0, "z_copy() invalid bits:%d\n", z.bits));
+		LOG((log_MISC,0, "z_copy() invalid bits:%d\n", z->bits));
 		return (-1);
 	}
 
-	LOG((log_MISC,5,"bits   : %#o (%#x)\n", z.bits, z.bits));
-	LOG((log_MISC,5,"max    : %#o (%#x)\n", z.max, z.max));
-	LOG((log_MISC,5,"maxmax : %#o (%#x)\n", z.maxmax, z.maxmax));
+	LOG((log_MISC,5,"bits   : %#o (%#x)\n", z->bits, z->bits));
+	LOG((log_MISC,5,"max    : %#o (%#x)\n", z->max, z->max));
+	LOG((log_MISC,5,"maxmax : %#o (%#x)\n", z->maxmax, z->maxmax));
 
 	/* initialize the first 256 entries in the table */
-	for (z.code = 255; z.code >= 0; z.code--) {
-		LZW_PREFIXOF(z.code) = 0;
-		LZW_SUFFIXOF(z.code) = (lzwchar_t)z.code;
+	for (z->code = 255; z->code >= 0; z->code--) {
+		LZW_PREFIXOF(z->code) = 0;
+		LZW_SUFFIXOF(z->code) = (lzwchar_t)z->code;
+		LZW_LENGTHOF(z->code) = 1;
 	}
+	return 0;
+}
 
-	z.final = z.old = getcode();
-	if (-1 == z.old)
-		goto eof;
-	if (z.ooffs >= z.osize)
-		goto full;
-	/* first code is 8 bits character */
-	z.op[z.ooffs++] = (lzwchar_t)z.final;
-	z.sp = LZW_DE_STACK;
+/** @brief load the decoder state into local variables */
+#define	LZW_LOAD() do { \
+	bbuf = z->bbuf; bcnt = z->bcnt; gleft = z->gleft; nbits = z->nbits; \
+	free = z->free; max = z->max; old = z->old; final = z->final; \
+	ooffs = z->ooffs; \
+} while (0)
 
-	while ((z.code = getcode()) > -1) {
+/** @brief store the decoder state from local variables */
+#define	LZW_SAVE() do { \
+	z->bbuf = bbuf; z->bcnt = bcnt; z->gleft = gleft; z->nbits = nbits; \
+	z->free = free; z->max = max; z->old = old; z->final = final; \
+	z->ooffs = ooffs; \
+} while (0)
 
-		if (z.block && LZW_CLEAR_CODE == z.code) {
+/**
+ * @brief uncompress the next part of a compress()d stream
+ *
+ * The string for a code is written backwards from its end, which is
+ * known from the string length table, straight into the output buffer.
+ * Only a string that does not fit into the rest of the output buffer
+ * goes to strbuf, and its tail is output on the next call.
+ *
+ * The state is kept in local variables, because the compiler has to
+ * assume that every byte written to the output may alias the stream.
+ *
+ * @param z pointer to the stream, with op and osize set up
+ * @result returns the number of bytes written to the output buffer, or -1 on error
+ */
+static off_t lzw_read(zstream_t *z)
+{
+	uint16_t *prefix = z->codetab;
+	uint16_t *length = z->lentab;
+	lzwchar_t *suffix = z->htab;
+	lzwchar_t *op = z->op;
+	size_t osize = z->osize;
+	lzwcode_t maxmax = z->maxmax;
+	int block = z->block;
+	lzwchar_t *dst, *p;
+	uint64_t bbuf;
+	int bcnt, gleft, nbits;
+	lzwcode_t code, incode, free, max, old, final;
+	size_t ooffs, len;
+
+	/* output the tail of a string that did not fit last time */
+	if (z->pend < z->plen) {
+		len = z->plen - z->pend;
+		if (len > osize - z->ooffs)
+			len = osize - z->ooffs;
+		memcpy(op + z->ooffs, z->strbuf + z->pend, len);
+		z->ooffs += len;
+		z->pend += len;
+		if (z->pend < z->plen)
+			goto full;
+	}
+
+	if (!z->started) {
+		if (z->eof || z->ooffs >= osize)
+			goto full;
+		z->final = z->old = getcode(z);
+		if (-1 == z->old)
+			goto eof;
+		/* first code is 8 bits character */
+		op[z->ooffs++] = (lzwchar_t)z->final;
+		z->started = 1;
+	}
+
+	LZW_LOAD();
+	for (;;) {
+		if (ooffs >= osize)
+			break;
+
+		if (free <= max && bcnt >= nbits) {
+			/* fast path: the code is in the bit buffer */
+			if (gleft <= 0)
+				gleft = nbits << 3;
+			code = (lzwcode_t)(bbuf & LZW_MAXCODE(nbits));
+			bbuf >>= nbits;
+			bcnt -= nbits;
+			gleft -= nbits;
+		} else {
+			LZW_SAVE();
+			code = getcode(z);
+			LZW_LOAD();
+			if (code < 0)
+				break;
+		}
+
+		if (block && LZW_CLEAR_CODE == code) {
 			/* reset the prefixes for characters */
-			for (z.code = 255; z.code >= 0; z.code--)
-				LZW_PREFIXOF(z.code) = 0;
-			z.clear = 1;
-			z.free = LZW_FIRST_CODE - 1;
-			z.code = getcode();
-			if (-1 == z.code)
+			for (code = 255; code >= 0; code--)
+				prefix[code] = 0;
+			z->clear = 1;
+			free = LZW_FIRST_CODE - 1;
+			LZW_SAVE();
+			code = getcode(z);
+			LZW_LOAD();
+			if (-1 == code)
 				break;
 		}
-		z.incode = z.code;
-
-		/* special case: repetitions */
-		if (z.code >= z.free) {
-			if (z.sp >= LZW_STACKTOP)
-				fatal(1, "bogus LZW compress() stack overrun\n");
-			*z.sp++ = z.final;
-			z.code = z.old;
+		incode = code;
+
+		/* special case: repetitions are the previous string plus its first character */
+		if (code >= free)
+			len = length[old] + 1;
+		else
+			len = length[code];
+
+		/* decode in place, or to strbuf if the string does not fit */
+		if (len <= osize - ooffs)
+			dst = op + ooffs;
+		else
+			dst = z->strbuf;
+		p = dst + len;
+
+		if (code >= free) {
+			*--p = (lzwchar_t)final;
+			code = old;
 		}
-
-		/* push suffixes */
-		while (z.code >= 256) {
-			if (z.code == LZW_PREFIXOF(z.code))
-				fatal(1, "code == prefix[code] (%x)", z.code);
-			if (z.sp >= LZW_STACKTOP)
-				fatal(1, "bogus LZW compress() stack overrun\n");
-			*z.sp++ = LZW_SUFFIXOF(z.code);
-			z.code = LZW_PREFIXOF(z.code);
+		while (code >= 256) {
+			if (p <= dst)
+				goto bogus;
+			*--p = suffix[code];
+			code = prefix[code];
 		}
-		z.final = LZW_SUFFIXOF(z.code);
-		*z.sp++ = z.final;
-
-#if	DEBUG_STACK
-		{
-			int i;
-			LOG((log_MISC,9,"code:%04x final:%02x old:%04x free:%04x " \
-				"max:%04x sp:%d i:%x o:%x (",
-				z.code, z.final, z.old, z.free, z.max,
-				(int)(z.sp - LZW_DE_STACK),
-				(long)z.ioffs, (long)z.ooffs));
-			for (i = 0; i < (int)(z.sp - LZW_DE_STACK); i++)
-				LOG((log_MISC,9,"%02x", z.sp[-1-i]));
-			LOG((log_MISC,9,")\n"));
+		if (p != dst + 1)
+			goto bogus;
+		final = suffix[code];
+		*--p = (lzwchar_t)final;
+
+		if (dst == z->strbuf) {
+			/* output what fits; the tail goes out on the next call */
+			z->pend = osize - ooffs;
+			z->plen = len;
+			memcpy(op + ooffs, z->strbuf, z->pend);
+			ooffs = osize;
+		} else {
+			ooffs += len;
 		}
-#endif
-
-		/* ... and pop the stack to the output */
-		do {
-			if (z.ooffs >= z.osize)
-				goto full;
-			z.op[z.ooffs++] = *--z.sp;
-		} while (z.sp > LZW_DE_STACK);
 
 		/* generate the new entry */
-		z.code = z.free;
-		if (z.code < z.maxmax) {
-			LZW_PREFIXOF(z.code) = (uint16_t)z.old;
-			LZW_SUFFIXOF(z.code) = z.final;
-			z.free = z.code + 1;
+		if (free < maxmax) {
+			prefix[free] = (uint16_t)old;
+			suffix[free] = (lzwchar_t)final;
+			length[free] = length[old] + 1;
+			free++;
 		}
 
 		/* remember previous code */
-		z.old = z.incode;
+		old = incode;
 	}
+	LZW_SAVE();
+	if (ooffs >= osize)
+		goto full;
 
 eof:
-	LOG((log_MISC,5, "z_copy() end of input at i:%x o:%x\n",
-		(long)z.ioffs, (long)z.ooffs));
-	/* return offs? */
-	return z.ooffs;
+	LOG((log_MISC,5, "z_read() end of input at i:%x o:%x\n",
+		(long)z->ioffs, (long)z->ooffs));
+	return z->ooffs;
 
 full:
-	LOG((log_MISC,5, "z_copy() uncompressed i:%x o:%x\n",
-		(long)z.ioffs, (long)z.ooffs));
-	return z.ooffs;
+	LOG((log_MISC,7, "z_read() uncompressed i:%x o:%x\n",
+		(long)z->ioffs, (long)z->ooffs));
+	return z->ooffs;
+
+bogus:
+	LOG((log_MISC,0, "bogus LZW compress() string length (%x)\n", incode));
+	z->eof = 1;
+	z->error = 1;
+	errno = EFTYPE;
+	return -1;
+}
+
+/**
+ * @brief uncompress a compress()d block of memory
+ *
+ * @param op pointer to output buffer
+ * @param osize number of bytes in output buffer
+ * @param ip pointer to input buffer
+ * @param isize number of bytes in input buffer
+ * @result returns the size of the uncompressed data, or -1 on error
+ */
+off_t z_copy(uint8_t *op, size_t osize, uint8_t *ip, size_t isize)
+{
+	zstream_t *z;
+	off_t size;
+
+	z = (zstream_t *)calloc(1, sizeof(zstream_t));
+	if (!z)
+		fatal(1, "failed to malloc(%d) bytes\n", sizeof(zstream_t));
+	z->type = 1;
+	if (lzw_init(z, ip, isize) < 0) {
+		free(z);
+		return -1;
+	}
+	z->op = op;
+	z->osize = osize;
+	size = lzw_read(z);
+	free(z);
+	return size;
 }
 
 /** @brief magic header of compressed files (gzip) */
@@ -647,3 +766,124 @@ int z_header(uint8_t *ip, size_t size, size_t *pskip)
 		*pskip = skip;
 	return 2;
 }
+
+/**
+ * @brief open a compress()d or gzip stream from a block of memory
+ *
+ * @param ip pointer to input buffer (must stay valid until z_close())
+ * @param isize number of bytes in input buffer
+ * @result returns a pointer to the stream, or NULL on error
+ */
+zstream_t *z_open(uint8_t *ip, size_t isize)
+{
+	zstream_t *z;
+	size_t skip;
+	int err;
+	int type = z_header(ip, isize, &skip);
+
+	if (1 != type && 2 != type) {
+		LOG((log_MISC,0, "compression type unknown, skip:%d\n", skip));
+		errno = EFTYPE;
+		return NULL;
+	}
+
+	z = (zstream_t *)calloc(1, sizeof(zstream_t));
+	if (!z)
+		fatal(1, "failed to malloc(%d) bytes\n", sizeof(zstream_t));
+	z->type = type;
+
+	if (1 == type) {
+		LOG((log_MISC,0, "compression type compress (LZW), skip:%d\n", skip));
+		if (lzw_init(z, ip + skip, isize - skip) < 0) {
+			free(z);
+			return NULL;
+		}
+		return z;
+	}
+
+	LOG((log_MISC,0, "compression type gzip, skip:%d\n", skip));
+	z->ip = ip;
+	z->isize = isize;
+	z->d.zalloc = (alloc_func)0;
+	z->d.zfree = (free_func)0;
+	z->d.opaque = (voidpf)0;
+	z->d.next_in = ip;
+	z->d.avail_in = (uInt)isize;
+	/* windowBits + 16 decodes the gzip header and trailer */
+	err = inflateInit2(&z->d, MAX_WBITS + 16);
+	if (err != Z_OK) {
+		LOG((log_MISC,0,"inflateInit2() returned %d (%s)\n",
+			err, z->d.msg ? z->d.msg : "-/-"));
+		free(z);
+		return NULL;
+	}
+	return z;
+}
+
+/**
+ * @brief uncompress the next part of a stream
+ *
+ * @param z pointer to the stream
+ * @param op pointer to output buffer
+ * @param osize number of bytes to uncompress at most
+ * @result returns the number of bytes, 0 at the end of the stream, or -1 on error
+ */
+off_t z_read(zstream_t *z, uint8_t *op, size_t osize)
+{
+	int err;
+
+	if (1 == z->type) {
+		if (z->error)
+			return -1;
+		z->op = op;
+		z->osize = osize;
+		z->ooffs = 0;
+		return lzw_read(z);
+	}
+
+	if (z->eof)
+		return 0;
+	z->d.next_out = op;
+	z->d.avail_out = (uInt)osize;
+	err = inflate(&z->d, Z_NO_FLUSH);
+	if (err == Z_STREAM_END) {
+		z->eof = 1;
+	} else if (err != Z_OK && err != Z_BUF_ERROR) {
+		LOG((log_MISC,0,"inflate(Z_NO_FLUSH) returned %d (%s)\n",
+			err, z->d.msg ? z->d.msg : "-/-"));
+		return -1;
+	}
+	return osize - z->d.avail_out;
+}
+
+/**
+ * @brief return the uncompressed size of a stream, if its format records it
+ *
+ * Only gzip has a trailer with the size (modulo 2^32) of its data.
+ *
+ * @param z pointer to the stream
+ * @result returns the size in bytes, or -1 if it is not known
+ */
+off_t z_size(zstream_t *z)
+{
+	const uint8_t *tp;
+
+	if (2 != z->type || z->isize < 18)
+		return -1;
+	tp = z->ip + z->isize - 4;
+	return (off_t)(tp[0] | (tp[1] << 8) | (tp[2] << 16) | ((uint32_t)tp[3] << 24));
+}
+
+/**
+ * @brief close a stream opened with z_open()
+ *
+ * @param z pointer to the stream
+ */
+void z_close(zstream_t *z)
+{
+	if (!z)
+		return;
+	if (2 == z->type)
+		inflateEnd(&z->d);
+	free(z);
+}
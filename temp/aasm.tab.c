@@ -0,0 +1,2849 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "tools/aasm.y"
+
+/**********************************************************
+ * Xerox Alto Assembler.
+ *
+ * Parser of the Xerox Alto assembler.
+ *
+ * (C) 2007 by Juergen Buchmueller <pullmoll@t-online.de>
+ *
+ * $Id: aasm.y,v 1.1.1.1 2008/07/22 19:02:07 pm Exp $
+ **********************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "emu_ops.h"
+
+typedef unsigned char   byte;
+typedef	unsigned short	word;
+
+typedef	struct	tagSYM {
+	struct tagSYM * next;
+	int pass_no;
+	int value;
+	int refs;
+	int *line_no;
+	char *name;
+}   SYM_t;
+
+void emit(void);
+
+void addsym(char * name, int value);
+int getsym(char * name);
+
+word *image = NULL;
+
+int symb_no = 0;
+int line_no = 1;
+int pass_no = 1;
+word cmd = 0x00;
+int arg[4096] = {0, };
+int expflg = 0;	/* print expression result */
+int cmdflg = 0;
+int argcnt = 0;
+int arglow = 0;
+int padflg = 0;	/* pad binary to new address */
+word eexp = 0;
+word end = 0;
+word tmp = 0;
+int pc	= 0;
+int pcmax = -1;
+int alloc = -1;
+
+char lstbuff[256+1] = "";
+char *plst  = NULL;
+
+SYM_t *sym = NULL;
+SYM_t *sym0 = NULL;
+
+char inpname[256+1] = "";
+char outname[256+1] = "";
+char lstname[256+1] = "";
+
+FILE *inpfile = NULL;
+FILE *outfile = NULL;
+FILE *lstfile = NULL;
+
+int f_dump  = 0;		/* generate octal dump as output */
+int f_list  = 0;		/* write listing file */
+int f_syms  = 0;		/* write symbols into listing file */
+int f_xref  = 0;		/* write cross references with symbols */
+int f_octal = 1;		/* print numbers as octal in listing (default) */
+
+extern void yyerror(const char *msg, ...);
+extern int yylex(void);
+extern void yyrestart(FILE *inputfile);
+
+
+#line 150 "aasm.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "aasm.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_EOL = 3,                        /* EOL  */
+  YYSYMBOL_HASH = 4,                       /* HASH  */
+  YYSYMBOL_COMMA = 5,                      /* COMMA  */
+  YYSYMBOL_COLON = 6,                      /* COLON  */
+  YYSYMBOL_LPAREN = 7,                     /* LPAREN  */
+  YYSYMBOL_RPAREN = 8,                     /* RPAREN  */
+  YYSYMBOL_QUOTE = 9,                      /* QUOTE  */
+  YYSYMBOL_PLUS = 10,                      /* PLUS  */
+  YYSYMBOL_MINUS = 11,                     /* MINUS  */
+  YYSYMBOL_ASTERISK = 12,                  /* ASTERISK  */
+  YYSYMBOL_SLASH = 13,                     /* SLASH  */
+  YYSYMBOL_SHL = 14,                       /* SHL  */
+  YYSYMBOL_SHR = 15,                       /* SHR  */
+  YYSYMBOL_AMPERSAND = 16,                 /* AMPERSAND  */
+  YYSYMBOL_BAR = 17,                       /* BAR  */
+  YYSYMBOL_CARET = 18,                     /* CARET  */
+  YYSYMBOL_TILDE = 19,                     /* TILDE  */
+  YYSYMBOL_AT = 20,                        /* AT  */
+  YYSYMBOL_IMM = 21,                       /* IMM  */
+  YYSYMBOL_REG = 22,                       /* REG  */
+  YYSYMBOL_SYM = 23,                       /* SYM  */
+  YYSYMBOL_CHR = 24,                       /* CHR  */
+  YYSYMBOL_ARITH = 25,                     /* ARITH  */
+  YYSYMBOL_AC = 26,                        /* AC  */
+  YYSYMBOL_SKP = 27,                       /* SKP  */
+  YYSYMBOL_SZC = 28,                       /* SZC  */
+  YYSYMBOL_SNC = 29,                       /* SNC  */
+  YYSYMBOL_SZR = 30,                       /* SZR  */
+  YYSYMBOL_SNR = 31,                       /* SNR  */
+  YYSYMBOL_SEZ = 32,                       /* SEZ  */
+  YYSYMBOL_SBN = 33,                       /* SBN  */
+  YYSYMBOL_JMP = 34,                       /* JMP  */
+  YYSYMBOL_JSR = 35,                       /* JSR  */
+  YYSYMBOL_DSZ = 36,                       /* DSZ  */
+  YYSYMBOL_ISZ = 37,                       /* ISZ  */
+  YYSYMBOL_LDA = 38,                       /* LDA  */
+  YYSYMBOL_STA = 39,                       /* STA  */
+  YYSYMBOL_COM = 40,                       /* COM  */
+  YYSYMBOL_NEG = 41,                       /* NEG  */
+  YYSYMBOL_MOV = 42,                       /* MOV  */
+  YYSYMBOL_INC = 43,                       /* INC  */
+  YYSYMBOL_ADC = 44,                       /* ADC  */
+  YYSYMBOL_SUB = 45,                       /* SUB  */
+  YYSYMBOL_ADD = 46,                       /* ADD  */
+  YYSYMBOL_AND = 47,                       /* AND  */
+  YYSYMBOL_CYCLE = 48,                     /* CYCLE  */
+  YYSYMBOL_MUL = 49,                       /* MUL  */
+  YYSYMBOL_DIV = 50,                       /* DIV  */
+  YYSYMBOL_JSRII = 51,                     /* JSRII  */
+  YYSYMBOL_JSRIS = 52,                     /* JSRIS  */
+  YYSYMBOL_CONVERT = 53,                   /* CONVERT  */
+  YYSYMBOL_DIR = 54,                       /* DIR  */
+  YYSYMBOL_EIR = 55,                       /* EIR  */
+  YYSYMBOL_BRI = 56,                       /* BRI  */
+  YYSYMBOL_RCLK = 57,                      /* RCLK  */
+  YYSYMBOL_SIO = 58,                       /* SIO  */
+  YYSYMBOL_BLT = 59,                       /* BLT  */
+  YYSYMBOL_BLKS = 60,                      /* BLKS  */
+  YYSYMBOL_SIT = 61,                       /* SIT  */
+  YYSYMBOL_JMPRAM = 62,                    /* JMPRAM  */
+  YYSYMBOL_RDRAM = 63,                     /* RDRAM  */
+  YYSYMBOL_WRTRAM = 64,                    /* WRTRAM  */
+  YYSYMBOL_DIRS = 65,                      /* DIRS  */
+  YYSYMBOL_VERS = 66,                      /* VERS  */
+  YYSYMBOL_DREAD = 67,                     /* DREAD  */
+  YYSYMBOL_DWRITE = 68,                    /* DWRITE  */
+  YYSYMBOL_DEXCH = 69,                     /* DEXCH  */
+  YYSYMBOL_DIAGNOSE1 = 70,                 /* DIAGNOSE1  */
+  YYSYMBOL_DIAGNOSE2 = 71,                 /* DIAGNOSE2  */
+  YYSYMBOL_BITBLT = 72,                    /* BITBLT  */
+  YYSYMBOL_XMLDA = 73,                     /* XMLDA  */
+  YYSYMBOL_XMSTA = 74,                     /* XMSTA  */
+  YYSYMBOL_DB = 75,                        /* DB  */
+  YYSYMBOL_DW = 76,                        /* DW  */
+  YYSYMBOL_DD = 77,                        /* DD  */
+  YYSYMBOL_DS = 78,                        /* DS  */
+  YYSYMBOL_ALIGN = 79,                     /* ALIGN  */
+  YYSYMBOL_END = 80,                       /* END  */
+  YYSYMBOL_EQU = 81,                       /* EQU  */
+  YYSYMBOL_EVEN = 82,                      /* EVEN  */
+  YYSYMBOL_ORG = 83,                       /* ORG  */
+  YYSYMBOL_YYACCEPT = 84,                  /* $accept  */
+  YYSYMBOL_file = 85,                      /* file  */
+  YYSYMBOL_line = 86,                      /* line  */
+  YYSYMBOL_token = 87,                     /* token  */
+  YYSYMBOL_symdef = 88,                    /* symdef  */
+  YYSYMBOL_arith = 89,                     /* arith  */
+  YYSYMBOL_skip = 90,                      /* skip  */
+  YYSYMBOL_ac2 = 91,                       /* ac2  */
+  YYSYMBOL_ac23 = 92,                      /* ac23  */
+  YYSYMBOL_SrcAC = 93,                     /* SrcAC  */
+  YYSYMBOL_DstAC = 94,                     /* DstAC  */
+  YYSYMBOL_ea = 95,                        /* ea  */
+  YYSYMBOL_disp = 96,                      /* disp  */
+  YYSYMBOL_rel8 = 97,                      /* rel8  */
+  YYSYMBOL_expr = 98,                      /* expr  */
+  YYSYMBOL_simple = 99,                    /* simple  */
+  YYSYMBOL_term = 100,                     /* term  */
+  YYSYMBOL_factor = 101,                   /* factor  */
+  YYSYMBOL_imm4 = 102,                     /* imm4  */
+  YYSYMBOL_imm8 = 103,                     /* imm8  */
+  YYSYMBOL_imm8list = 104,                 /* imm8list  */
+  YYSYMBOL_imm16 = 105,                    /* imm16  */
+  YYSYMBOL_imm16list = 106,                /* imm16list  */
+  YYSYMBOL_imm32 = 107,                    /* imm32  */
+  YYSYMBOL_imm32list = 108,                /* imm32list  */
+  YYSYMBOL_str = 109,                      /* str  */
+  YYSYMBOL_strlist = 110                   /* strlist  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  20
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   460
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  84
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  27
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  123
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  274
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   338
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   113,   113,   114,   117,   118,   121,   125,   131,   135,
+     144,   146,   148,   150,   152,   154,   156,   158,   161,   163,
+     165,   167,   170,   172,   174,   176,   178,   180,   182,   184,
+     187,   189,   191,   193,   195,   197,   199,   201,   203,   205,
+     207,   209,   211,   213,   215,   217,   219,   221,   223,   225,
+     227,   229,   231,   233,   235,   237,   239,   241,   244,   246,
+     248,   250,   252,   262,   270,   280,   289,   299,   300,   308,
+     311,   319,   322,   326,   330,   334,   338,   342,   346,   352,
+     360,   370,   379,   390,   399,   410,   419,   430,   444,   452,
+     462,   472,   482,   484,   486,   490,   492,   494,   496,   500,
+     502,   504,   506,   508,   510,   512,   514,   518,   520,   522,
+     526,   535,   548,   549,   552,   561,   562,   565,   575,   576,
+     579,   592,   595,   596
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "EOL", "HASH", "COMMA",
+  "COLON", "LPAREN", "RPAREN", "QUOTE", "PLUS", "MINUS", "ASTERISK",
+  "SLASH", "SHL", "SHR", "AMPERSAND", "BAR", "CARET", "TILDE", "AT", "IMM",
+  "REG", "SYM", "CHR", "ARITH", "AC", "SKP", "SZC", "SNC", "SZR", "SNR",
+  "SEZ", "SBN", "JMP", "JSR", "DSZ", "ISZ", "LDA", "STA", "COM", "NEG",
+  "MOV", "INC", "ADC", "SUB", "ADD", "AND", "CYCLE", "MUL", "DIV", "JSRII",
+  "JSRIS", "CONVERT", "DIR", "EIR", "BRI", "RCLK", "SIO", "BLT", "BLKS",
+  "SIT", "JMPRAM", "RDRAM", "WRTRAM", "DIRS", "VERS", "DREAD", "DWRITE",
+  "DEXCH", "DIAGNOSE1", "DIAGNOSE2", "BITBLT", "XMLDA", "XMSTA", "DB",
+  "DW", "DD", "DS", "ALIGN", "END", "EQU", "EVEN", "ORG", "$accept",
+  "file", "line", "token", "symdef", "arith", "skip", "ac2", "ac23",
+  "SrcAC", "DstAC", "ea", "disp", "rel8", "expr", "simple", "term",
+  "factor", "imm4", "imm8", "imm8list", "imm16", "imm16list", "imm32",
+  "imm32list", "str", "strlist", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-67)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-68)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+       8,   -67,     3,   416,    12,   204,   -67,   282,   -67,   416,
+     416,     1,     1,     1,   -67,   -67,    41,   100,   140,   -67,
+     -67,   -67,   -67,   -67,   356,   361,   376,   381,   102,   102,
+     -22,   -22,   -22,   -22,   -22,   -22,   -22,   -22,   416,    31,
+      39,   416,   416,   416,    56,    68,    79,    97,   111,   117,
+     119,   121,   123,   127,   130,   134,   136,   142,   144,   152,
+     153,   157,   166,   168,   170,   287,   416,   416,   416,    29,
+     416,   171,    32,   -67,    18,    46,     2,   -67,   -67,   -67,
+     -67,   416,   416,   416,   416,   416,     1,     1,     1,     1,
+     416,   172,    22,   416,   173,   416,   174,   416,   176,   175,
+     396,    32,   401,   -67,   108,   108,   108,   108,   108,   108,
+     108,   108,    32,   177,   -67,   -67,   178,    32,   180,    32,
+      47,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,    32,   -67,    25,   -67,    48,    69,    32,
+     -67,    74,   182,   190,   191,   -67,   -67,   416,   -67,   -67,
+     100,   100,   140,   140,   140,   -67,   -67,   -67,   -67,   192,
+     -67,   125,   193,   -67,    32,   194,   -67,   195,   -67,   196,
+     -67,   416,   416,   199,   416,   205,   202,   102,    32,   102,
+     102,   102,   102,   102,   102,   102,   -67,   -67,   -67,   210,
+     203,   209,    32,   -67,   416,   -67,   287,   -67,   -67,   416,
+     -67,   -67,   -67,   -67,   -67,   -67,   416,   -67,   -67,   -67,
+      61,   213,   -67,   215,   -67,   198,   413,   413,   413,   413,
+     413,   413,   413,   413,   219,   416,   -67,   -67,   -67,   -67,
+     -67,    72,   -67,   -67,   -67,   216,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   223,   225,   227,   231,   232,   234,   285,
+     288,   -67,   135,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   -67
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+      67,     6,     0,     0,     0,     0,     5,     0,    68,     0,
+       0,     0,     0,     0,   107,   108,     0,    92,    95,    99,
+       1,     3,     4,     7,     0,     0,     0,     0,     0,     0,
+      69,    69,    69,    69,    69,    69,    69,    69,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   114,   116,     0,     0,     0,   100,   101,   102,
+      63,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    87,     0,     0,     0,     0,     0,     0,     0,
+       0,    85,     0,    70,     0,     0,     0,     0,     0,     0,
+       0,     0,   110,     0,    31,    32,     0,    90,     0,    91,
+       0,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,   120,   111,   113,     0,   123,     0,     0,   117,
+     119,     0,     0,     0,     0,    65,     8,     0,     9,   109,
+      93,    94,    96,    97,    98,   103,   104,   105,   106,     0,
+      10,     0,     0,    88,    81,     0,    12,     0,    16,     0,
+      14,     0,     0,     0,     0,     0,     0,     0,    83,     0,
+       0,     0,     0,     0,     0,     0,    30,    33,    34,     0,
+       0,     0,    79,    58,     0,    59,     0,    60,    61,     0,
+      62,    64,    66,   115,    11,    89,     0,    13,    17,    15,
+       0,     0,    18,     0,    20,     0,    71,    71,    71,    71,
+      71,    71,    71,    71,     0,     0,    35,   112,   121,   122,
+     118,     0,    86,    19,    21,     0,    72,    73,    74,    75,
+      76,    77,    78,     0,     0,     0,     0,     0,     0,     0,
+       0,    36,     0,    82,    84,    22,    23,    24,    25,    26,
+      27,    28,    29,    80
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+     -67,   -67,   -67,   290,   -67,   397,   220,    91,   128,   349,
+     -28,   -12,   -67,   253,    -3,    60,    14,     7,   -67,   -66,
+     -67,   -65,   236,    95,   -67,    94,   -67
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     4,     5,     6,     7,   104,   253,   201,   173,   187,
+     100,    91,   116,   118,    92,    17,    18,    19,   113,   144,
+     145,    73,    74,   150,   151,   146,   147
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      16,   102,   152,   103,    72,   154,    75,    76,    10,     8,
+     159,     1,    20,    94,    96,    98,    81,    82,    77,    78,
+      79,   156,    14,   157,    15,   101,   101,   171,   203,    10,
+     204,     2,    11,    12,   114,   112,    81,    82,   117,   119,
+     119,    13,   115,    14,    80,    15,    81,    82,   172,   158,
+     153,   205,   199,   206,    10,    81,    82,    11,    12,   121,
+      81,    82,   143,    72,   149,   143,    13,    72,    14,   242,
+      15,   122,   207,   200,   157,    81,    82,   208,   169,   209,
+     263,   175,   123,   177,     9,   179,    81,    82,   183,   174,
+     185,     3,   213,   165,   166,   167,   168,   162,   163,   164,
+     124,   188,   188,   188,   188,   188,   188,   188,   188,    10,
+      83,    84,    11,    12,   125,    10,    85,   202,    11,    12,
+     126,    13,   127,    14,   128,    15,   129,    13,    99,    14,
+     130,    15,    10,   131,   186,    11,    12,   132,   237,   133,
+     238,   160,   161,   273,    13,   134,    14,   135,    15,    81,
+      82,   172,    86,    87,    72,   136,   137,    88,    89,   226,
+     138,   227,   228,   229,   230,   231,   232,   233,   174,   139,
+     221,   140,   223,   141,   155,   170,   176,   178,   220,   180,
+     196,   197,   181,   198,   101,   210,   101,   101,   101,   101,
+     101,   101,   101,   211,   212,   214,   202,   217,   218,   219,
+     216,   143,   222,   143,    -2,    21,   149,     1,   224,   225,
+     235,   -67,   236,   241,   -67,   -67,   243,    10,   244,   245,
+      11,    12,   261,   -67,   264,   -67,   265,     2,   266,    13,
+     267,    14,   262,    15,   268,   269,   200,   270,   -67,   -67,
+     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   -67,   -67,    23,   -67,     3,   271,    10,
+     234,   272,    11,    12,    10,    22,   120,    11,    12,   215,
+     239,    13,   148,    14,   240,    15,    13,     0,    14,     0,
+      15,   142,     0,     0,     0,     0,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    10,    71,     0,    11,    12,    10,     0,
+       0,    11,    12,     0,     0,    13,    90,    14,     0,    15,
+      13,    93,    14,    10,    15,     0,    11,    12,    10,     0,
+       0,    11,    12,     0,     0,    13,    95,    14,     0,    15,
+      13,    97,    14,    10,    15,     0,    11,    12,    10,     0,
+       0,    11,    12,     0,     0,    13,   182,    14,     0,    15,
+      13,   184,    14,    10,    15,     0,    11,    12,   105,   106,
+     107,   108,   109,   110,   111,    13,     0,    14,     0,    15,
+     246,   247,   248,   249,   250,   251,   252,   254,   255,   256,
+     257,   258,   259,   260,   189,   190,   191,   192,   193,   194,
+     195
+};
+
+static const yytype_int16 yycheck[] =
+{
+       3,    29,    68,    25,     7,    70,     9,    10,     7,     6,
+       8,     3,     0,    25,    26,    27,    14,    15,    11,    12,
+      13,     3,    21,     5,    23,    28,    29,     5,     3,     7,
+       5,    23,    10,    11,     3,    38,    14,    15,    41,    42,
+      43,    19,     3,    21,     3,    23,    14,    15,    26,     3,
+      21,     3,     5,     5,     7,    14,    15,    10,    11,     3,
+      14,    15,    65,    66,    67,    68,    19,    70,    21,     8,
+      23,     3,     3,    26,     5,    14,    15,     3,    90,     5,
+       8,    93,     3,    95,    81,    97,    14,    15,   100,    92,
+     102,    83,   157,    86,    87,    88,    89,    83,    84,    85,
+       3,   104,   105,   106,   107,   108,   109,   110,   111,     7,
+      10,    11,    10,    11,     3,     7,    16,   120,    10,    11,
+       3,    19,     3,    21,     3,    23,     3,    19,    26,    21,
+       3,    23,     7,     3,    26,    10,    11,     3,   204,     3,
+     206,    81,    82,     8,    19,     3,    21,     3,    23,    14,
+      15,    26,    12,    13,   157,     3,     3,    17,    18,   187,
+       3,   189,   190,   191,   192,   193,   194,   195,   171,     3,
+     182,     3,   184,     3,     3,     3,     3,     3,   181,     3,
+       3,     3,     7,     3,   187,     3,   189,   190,   191,   192,
+     193,   194,   195,     3,     3,     3,   199,     3,     3,     3,
+       7,   204,     3,   206,     0,     1,   209,     3,     3,     7,
+       7,     7,     3,   216,    10,    11,     3,     7,     3,    21,
+      10,    11,     3,    19,     8,    21,     3,    23,     3,    19,
+       3,    21,   235,    23,     3,     3,    26,     3,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,     3,    82,    83,     3,     7,
+     199,     3,    10,    11,     7,     5,    43,    10,    11,   171,
+     206,    19,    66,    21,   209,    23,    19,    -1,    21,    -1,
+      23,    24,    -1,    -1,    -1,    -1,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,     7,    82,    -1,    10,    11,     7,    -1,
+      -1,    10,    11,    -1,    -1,    19,    20,    21,    -1,    23,
+      19,    20,    21,     7,    23,    -1,    10,    11,     7,    -1,
+      -1,    10,    11,    -1,    -1,    19,    20,    21,    -1,    23,
+      19,    20,    21,     7,    23,    -1,    10,    11,     7,    -1,
+      -1,    10,    11,    -1,    -1,    19,    20,    21,    -1,    23,
+      19,    20,    21,     7,    23,    -1,    10,    11,    31,    32,
+      33,    34,    35,    36,    37,    19,    -1,    21,    -1,    23,
+      27,    28,    29,    30,    31,    32,    33,   227,   228,   229,
+     230,   231,   232,   233,   105,   106,   107,   108,   109,   110,
+     111
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     3,    23,    83,    85,    86,    87,    88,     6,    81,
+       7,    10,    11,    19,    21,    23,    98,    99,   100,   101,
+       0,     1,    87,     3,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    82,    98,   105,   106,    98,    98,   101,   101,   101,
+       3,    14,    15,    10,    11,    16,    12,    13,    17,    18,
+      20,    95,    98,    20,    95,    20,    95,    20,    95,    26,
+      94,    98,    94,    25,    89,    89,    89,    89,    89,    89,
+      89,    89,    98,   102,     3,     3,    96,    98,    97,    98,
+      97,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,    24,    98,   103,   104,   109,   110,   106,    98,
+     107,   108,   103,    21,   105,     3,     3,     5,     3,     8,
+      99,    99,   100,   100,   100,   101,   101,   101,   101,    95,
+       3,     5,    26,    92,    98,    95,     3,    95,     3,    95,
+       3,     7,    20,    95,    20,    95,    26,    93,    98,    93,
+      93,    93,    93,    93,    93,    93,     3,     3,     3,     5,
+      26,    91,    98,     3,     5,     3,     5,     3,     3,     5,
+       3,     3,     3,   105,     3,    92,     7,     3,     3,     3,
+      98,    95,     3,    95,     3,     7,    94,    94,    94,    94,
+      94,    94,    94,    94,    91,     7,     3,   103,   103,   109,
+     107,    98,     8,     3,     3,    21,    27,    28,    29,    30,
+      31,    32,    33,    90,    90,    90,    90,    90,    90,    90,
+      90,     3,    98,     8,     8,     3,     3,     3,     3,     3,
+       3,     3,     3,     8
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    84,    85,    85,    86,    86,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    88,    88,    89,
+      89,    90,    90,    90,    90,    90,    90,    90,    90,    91,
+      91,    92,    92,    93,    93,    94,    94,    95,    95,    95,
+      96,    97,    98,    98,    98,    99,    99,    99,    99,   100,
+     100,   100,   100,   100,   100,   100,   100,   101,   101,   101,
+     102,   103,   104,   104,   105,   106,   106,   107,   108,   108,
+     109,   109,   110,   110
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     2,     1,     1,     2,     3,     4,
+       4,     5,     4,     5,     4,     5,     4,     5,     5,     6,
+       5,     6,     7,     7,     7,     7,     7,     7,     7,     7,
+       4,     3,     3,     4,     4,     5,     6,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     4,     4,
+       4,     4,     4,     3,     4,     3,     4,     0,     2,     0,
+       1,     0,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     1,     4,     1,     4,     1,     4,     1,     2,     3,
+       1,     1,     1,     3,     3,     1,     3,     3,     3,     1,
+       2,     2,     2,     3,     3,     3,     3,     1,     1,     3,
+       1,     1,     3,     1,     1,     3,     1,     1,     3,     1,
+       1,     1,     3,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* line: line token  */
+#line 117 "tools/aasm.y"
+                           { emit(); }
+#line 1466 "aasm.tab.c"
+    break;
+
+  case 5: /* line: token  */
+#line 118 "tools/aasm.y"
+                      { emit(); }
+#line 1472 "aasm.tab.c"
+    break;
+
+  case 6: /* token: EOL  */
+#line 122 "tools/aasm.y"
+                {
+			cmdflg = 0;
+		}
+#line 1480 "aasm.tab.c"
+    break;
+
+  case 7: /* token: symdef EOL  */
+#line 126 "tools/aasm.y"
+                {
+			cmdflg = 0;
+			expflg = 1;
+			eexp = pc;
+		}
+#line 1490 "aasm.tab.c"
+    break;
+
+  case 8: /* token: symdef imm16list EOL  */
+#line 132 "tools/aasm.y"
+                {
+			cmdflg = 0;
+		}
+#line 1498 "aasm.tab.c"
+    break;
+
+  case 9: /* token: SYM EQU expr EOL  */
+#line 136 "tools/aasm.y"
+                {
+			cmdflg = 0;
+			argcnt = 0;
+			expflg = 1;
+			eexp = (yyvsp[-1].i);
+			addsym((yyvsp[-3].s), (yyvsp[-1].i));
+			free((yyvsp[-3].s));
+		}
+#line 1511 "aasm.tab.c"
+    break;
+
+  case 10: /* token: symdef JMP ea EOL  */
+#line 145 "tools/aasm.y"
+                { cmd |= op_JMP | ea_DIRECT | (yyvsp[-1].i); }
+#line 1517 "aasm.tab.c"
+    break;
+
+  case 11: /* token: symdef JMP AT ea EOL  */
+#line 147 "tools/aasm.y"
+                { cmd |= op_JMP | ea_INDIRECT | (yyvsp[-1].i); }
+#line 1523 "aasm.tab.c"
+    break;
+
+  case 12: /* token: symdef JSR ea EOL  */
+#line 149 "tools/aasm.y"
+                { cmd |= op_JSR | ea_DIRECT | (yyvsp[-1].i); }
+#line 1529 "aasm.tab.c"
+    break;
+
+  case 13: /* token: symdef JSR AT ea EOL  */
+#line 151 "tools/aasm.y"
+                { cmd |= op_JSR | ea_INDIRECT | (yyvsp[-1].i); }
+#line 1535 "aasm.tab.c"
+    break;
+
+  case 14: /* token: symdef ISZ ea EOL  */
+#line 153 "tools/aasm.y"
+                { cmd |= op_ISZ | ea_DIRECT | (yyvsp[-1].i); }
+#line 1541 "aasm.tab.c"
+    break;
+
+  case 15: /* token: symdef ISZ AT ea EOL  */
+#line 155 "tools/aasm.y"
+                { cmd |= op_ISZ | ea_INDIRECT | (yyvsp[-1].i); }
+#line 1547 "aasm.tab.c"
+    break;
+
+  case 16: /* token: symdef DSZ ea EOL  */
+#line 157 "tools/aasm.y"
+                { cmd |= op_DSZ | ea_DIRECT | (yyvsp[-1].i); }
+#line 1553 "aasm.tab.c"
+    break;
+
+  case 17: /* token: symdef DSZ AT ea EOL  */
+#line 159 "tools/aasm.y"
+                { cmd |= op_DSZ | ea_INDIRECT | (yyvsp[-1].i); }
+#line 1559 "aasm.tab.c"
+    break;
+
+  case 18: /* token: symdef LDA DstAC ea EOL  */
+#line 162 "tools/aasm.y"
+                { cmd |= op_LDA | ea_DIRECT | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1565 "aasm.tab.c"
+    break;
+
+  case 19: /* token: symdef LDA DstAC AT ea EOL  */
+#line 164 "tools/aasm.y"
+                { cmd |= op_LDA | ea_INDIRECT | (yyvsp[-3].i) | (yyvsp[-1].i); }
+#line 1571 "aasm.tab.c"
+    break;
+
+  case 20: /* token: symdef STA DstAC ea EOL  */
+#line 166 "tools/aasm.y"
+                { cmd |= op_STA | ea_DIRECT | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1577 "aasm.tab.c"
+    break;
+
+  case 21: /* token: symdef STA DstAC AT ea EOL  */
+#line 168 "tools/aasm.y"
+                { cmd |= op_STA | ea_INDIRECT | (yyvsp[-3].i) | (yyvsp[-1].i); }
+#line 1583 "aasm.tab.c"
+    break;
+
+  case 22: /* token: symdef COM arith SrcAC DstAC skip EOL  */
+#line 171 "tools/aasm.y"
+                { cmd |= op_COM | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1589 "aasm.tab.c"
+    break;
+
+  case 23: /* token: symdef NEG arith SrcAC DstAC skip EOL  */
+#line 173 "tools/aasm.y"
+                { cmd |= op_NEG | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1595 "aasm.tab.c"
+    break;
+
+  case 24: /* token: symdef MOV arith SrcAC DstAC skip EOL  */
+#line 175 "tools/aasm.y"
+                { cmd |= op_MOV | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1601 "aasm.tab.c"
+    break;
+
+  case 25: /* token: symdef INC arith SrcAC DstAC skip EOL  */
+#line 177 "tools/aasm.y"
+                { cmd |= op_INC | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1607 "aasm.tab.c"
+    break;
+
+  case 26: /* token: symdef ADC arith SrcAC DstAC skip EOL  */
+#line 179 "tools/aasm.y"
+                { cmd |= op_ADC | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1613 "aasm.tab.c"
+    break;
+
+  case 27: /* token: symdef SUB arith SrcAC DstAC skip EOL  */
+#line 181 "tools/aasm.y"
+                { cmd |= op_SUB | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1619 "aasm.tab.c"
+    break;
+
+  case 28: /* token: symdef ADD arith SrcAC DstAC skip EOL  */
+#line 183 "tools/aasm.y"
+                { cmd |= op_ADD | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1625 "aasm.tab.c"
+    break;
+
+  case 29: /* token: symdef AND arith SrcAC DstAC skip EOL  */
+#line 185 "tools/aasm.y"
+                { cmd |= op_AND | (yyvsp[-4].i) | (yyvsp[-3].i) | (yyvsp[-2].i) | (yyvsp[-1].i); }
+#line 1631 "aasm.tab.c"
+    break;
+
+  case 30: /* token: symdef CYCLE imm4 EOL  */
+#line 188 "tools/aasm.y"
+                { cmd |= op_CYCLE | (yyvsp[-1].i); }
+#line 1637 "aasm.tab.c"
+    break;
+
+  case 31: /* token: symdef MUL EOL  */
+#line 190 "tools/aasm.y"
+                { cmd |= op_MUL; }
+#line 1643 "aasm.tab.c"
+    break;
+
+  case 32: /* token: symdef DIV EOL  */
+#line 192 "tools/aasm.y"
+                { cmd |= op_DIV; }
+#line 1649 "aasm.tab.c"
+    break;
+
+  case 33: /* token: symdef JSRII disp EOL  */
+#line 194 "tools/aasm.y"
+                { cmd |= op_JSRII | (yyvsp[-1].i); }
+#line 1655 "aasm.tab.c"
+    break;
+
+  case 34: /* token: symdef JSRIS rel8 EOL  */
+#line 196 "tools/aasm.y"
+                { cmd |= op_JSRIS | (yyvsp[-1].i); }
+#line 1661 "aasm.tab.c"
+    break;
+
+  case 35: /* token: symdef CONVERT rel8 ac2 EOL  */
+#line 198 "tools/aasm.y"
+                { cmd |= op_CONVERT | (yyvsp[-2].i); }
+#line 1667 "aasm.tab.c"
+    break;
+
+  case 36: /* token: symdef CONVERT rel8 COMMA ac2 EOL  */
+#line 200 "tools/aasm.y"
+                { cmd |= op_CONVERT | (yyvsp[-3].i); }
+#line 1673 "aasm.tab.c"
+    break;
+
+  case 37: /* token: symdef DIR EOL  */
+#line 202 "tools/aasm.y"
+                { cmd |= op_DIR; }
+#line 1679 "aasm.tab.c"
+    break;
+
+  case 38: /* token: symdef EIR EOL  */
+#line 204 "tools/aasm.y"
+                { cmd |= op_EIR; }
+#line 1685 "aasm.tab.c"
+    break;
+
+  case 39: /* token: symdef BRI EOL  */
+#line 206 "tools/aasm.y"
+                { cmd |= op_BRI; }
+#line 1691 "aasm.tab.c"
+    break;
+
+  case 40: /* token: symdef RCLK EOL  */
+#line 208 "tools/aasm.y"
+                { cmd |= op_RCLK; }
+#line 1697 "aasm.tab.c"
+    break;
+
+  case 41: /* token: symdef SIO EOL  */
+#line 210 "tools/aasm.y"
+                { cmd |= op_SIO; }
+#line 1703 "aasm.tab.c"
+    break;
+
+  case 42: /* token: symdef BLT EOL  */
+#line 212 "tools/aasm.y"
+                { cmd |= op_BLT; }
+#line 1709 "aasm.tab.c"
+    break;
+
+  case 43: /* token: symdef BLKS EOL  */
+#line 214 "tools/aasm.y"
+                { cmd |= op_BLKS; }
+#line 1715 "aasm.tab.c"
+    break;
+
+  case 44: /* token: symdef SIT EOL  */
+#line 216 "tools/aasm.y"
+                { cmd |= op_SIT; }
+#line 1721 "aasm.tab.c"
+    break;
+
+  case 45: /* token: symdef JMPRAM EOL  */
+#line 218 "tools/aasm.y"
+                { cmd |= op_JMPRAM; }
+#line 1727 "aasm.tab.c"
+    break;
+
+  case 46: /* token: symdef RDRAM EOL  */
+#line 220 "tools/aasm.y"
+                { cmd |= op_RDRAM; }
+#line 1733 "aasm.tab.c"
+    break;
+
+  case 47: /* token: symdef WRTRAM EOL  */
+#line 222 "tools/aasm.y"
+                { cmd |= op_WRTRAM; }
+#line 1739 "aasm.tab.c"
+    break;
+
+  case 48: /* token: symdef DIRS EOL  */
+#line 224 "tools/aasm.y"
+                { cmd |= op_DIRS; }
+#line 1745 "aasm.tab.c"
+    break;
+
+  case 49: /* token: symdef VERS EOL  */
+#line 226 "tools/aasm.y"
+                { cmd |= op_VERS; }
+#line 1751 "aasm.tab.c"
+    break;
+
+  case 50: /* token: symdef DREAD EOL  */
+#line 228 "tools/aasm.y"
+                { cmd |= op_DREAD; }
+#line 1757 "aasm.tab.c"
+    break;
+
+  case 51: /* token: symdef DWRITE EOL  */
+#line 230 "tools/aasm.y"
+                { cmd |= op_DWRITE; }
+#line 1763 "aasm.tab.c"
+    break;
+
+  case 52: /* token: symdef DEXCH EOL  */
+#line 232 "tools/aasm.y"
+                { cmd |= op_DEXCH; }
+#line 1769 "aasm.tab.c"
+    break;
+
+  case 53: /* token: symdef DIAGNOSE1 EOL  */
+#line 234 "tools/aasm.y"
+                { cmd |= op_DIAGNOSE1; }
+#line 1775 "aasm.tab.c"
+    break;
+
+  case 54: /* token: symdef DIAGNOSE2 EOL  */
+#line 236 "tools/aasm.y"
+                { cmd |= op_DIAGNOSE2; }
+#line 1781 "aasm.tab.c"
+    break;
+
+  case 55: /* token: symdef BITBLT EOL  */
+#line 238 "tools/aasm.y"
+                { cmd |= op_BITBLT; }
+#line 1787 "aasm.tab.c"
+    break;
+
+  case 56: /* token: symdef XMLDA EOL  */
+#line 240 "tools/aasm.y"
+                { cmd |= op_XMLDA; }
+#line 1793 "aasm.tab.c"
+    break;
+
+  case 57: /* token: symdef XMSTA EOL  */
+#line 242 "tools/aasm.y"
+                { cmd |= op_XMSTA; }
+#line 1799 "aasm.tab.c"
+    break;
+
+  case 58: /* token: symdef DB imm8list EOL  */
+#line 245 "tools/aasm.y"
+                { cmdflg = 0; }
+#line 1805 "aasm.tab.c"
+    break;
+
+  case 59: /* token: symdef DB strlist EOL  */
+#line 247 "tools/aasm.y"
+                { cmdflg = 0; }
+#line 1811 "aasm.tab.c"
+    break;
+
+  case 60: /* token: symdef DW imm16list EOL  */
+#line 249 "tools/aasm.y"
+                { cmdflg = 0; }
+#line 1817 "aasm.tab.c"
+    break;
+
+  case 61: /* token: symdef DD imm32list EOL  */
+#line 251 "tools/aasm.y"
+                { cmdflg = 0; }
+#line 1823 "aasm.tab.c"
+    break;
+
+  case 62: /* token: symdef DS imm8 EOL  */
+#line 253 "tools/aasm.y"
+                {
+			cmdflg = 0;
+			argcnt = arg[0];
+			if (argcnt > sizeof(arg)/sizeof(arg[0])) {
+				fprintf(stderr, "line (%d) warning: size clipped to assembler limits (%d : %d)\n", line_no, argcnt, sizeof(arg));
+				argcnt = sizeof(arg)/sizeof(arg[0]);
+			}
+			memset(arg, 0, argcnt * sizeof(arg[0]));
+		}
+#line 1837 "aasm.tab.c"
+    break;
+
+  case 63: /* token: ORG expr EOL  */
+#line 263 "tools/aasm.y"
+                {
+			cmdflg = 0;
+			argcnt = 0;
+			expflg = 1;
+			eexp = (yyvsp[-1].i);
+			pc = eexp;
+		}
+#line 1849 "aasm.tab.c"
+    break;
+
+  case 64: /* token: symdef ALIGN IMM EOL  */
+#line 271 "tools/aasm.y"
+                {
+			cmdflg = 0;
+			argcnt = 0;
+			expflg = 1;
+			eexp = pc;
+			tmp = (yyvsp[-1].i) - 1;
+			while (((pc + argcnt) & tmp) && argcnt < (sizeof(arg)/sizeof(arg[0])))
+				arg[argcnt++] = 0;
+		}
+#line 1863 "aasm.tab.c"
+    break;
+
+  case 65: /* token: symdef EVEN EOL  */
+#line 281 "tools/aasm.y"
+                {
+			cmdflg = 0;
+			argcnt = 0;
+			expflg = 1;
+			eexp = pc;
+			if (pc & 1)
+				arg[argcnt++] = 0;
+		}
+#line 1876 "aasm.tab.c"
+    break;
+
+  case 66: /* token: symdef END imm16 EOL  */
+#line 290 "tools/aasm.y"
+                {
+			cmdflg = 0;
+			argcnt = 0;
+			expflg = 1;
+			eexp = arg[0];
+			end = eexp;
+		}
+#line 1888 "aasm.tab.c"
+    break;
+
+  case 68: /* symdef: SYM COLON  */
+#line 301 "tools/aasm.y"
+                {
+			addsym((yyvsp[-1].s), pc);
+			free((yyvsp[-1].s));
+		}
+#line 1897 "aasm.tab.c"
+    break;
+
+  case 69: /* arith: %empty  */
+#line 308 "tools/aasm.y"
+                {
+			(yyval.i) = 0;
+		}
+#line 1905 "aasm.tab.c"
+    break;
+
+  case 70: /* arith: ARITH  */
+#line 312 "tools/aasm.y"
+                {
+			(yyval.i) = (yyvsp[0].i);
+		}
+#line 1913 "aasm.tab.c"
+    break;
+
+  case 71: /* skip: %empty  */
+#line 319 "tools/aasm.y"
+                {
+			(yyval.i) = 0;
+		}
+#line 1921 "aasm.tab.c"
+    break;
+
+  case 72: /* skip: SKP  */
+#line 323 "tools/aasm.y"
+                {
+			(yyval.i) = sk_SKP;
+		}
+#line 1929 "aasm.tab.c"
+    break;
+
+  case 73: /* skip: SZC  */
+#line 327 "tools/aasm.y"
+                {
+			(yyval.i) = sk_SZC;
+		}
+#line 1937 "aasm.tab.c"
+    break;
+
+  case 74: /* skip: SNC  */
+#line 331 "tools/aasm.y"
+                {
+			(yyval.i) = sk_SNC;
+		}
+#line 1945 "aasm.tab.c"
+    break;
+
+  case 75: /* skip: SZR  */
+#line 335 "tools/aasm.y"
+                {
+			(yyval.i) = sk_SZR;
+		}
+#line 1953 "aasm.tab.c"
+    break;
+
+  case 76: /* skip: SNR  */
+#line 339 "tools/aasm.y"
+                {
+			(yyval.i) = sk_SNR;
+		}
+#line 1961 "aasm.tab.c"
+    break;
+
+  case 77: /* skip: SEZ  */
+#line 343 "tools/aasm.y"
+                {
+			(yyval.i) = sk_SEZ;
+		}
+#line 1969 "aasm.tab.c"
+    break;
+
+  case 78: /* skip: SBN  */
+#line 347 "tools/aasm.y"
+                {
+			(yyval.i) = sk_SBN;
+		}
+#line 1977 "aasm.tab.c"
+    break;
+
+  case 79: /* ac2: expr  */
+#line 353 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) != 2) {
+				fprintf(stderr, "line (%d) fatal: only AC(2) can be base register\n",
+					line_no);
+				exit(1);
+			}
+		}
+#line 1989 "aasm.tab.c"
+    break;
+
+  case 80: /* ac2: AC LPAREN expr RPAREN  */
+#line 361 "tools/aasm.y"
+                {
+			if ((yyvsp[-1].i) != 2) {
+				fprintf(stderr, "line (%d) fatal: only AC(2) can be base register\n",
+					line_no);
+				exit(1);
+			}
+		}
+#line 2001 "aasm.tab.c"
+    break;
+
+  case 81: /* ac23: expr  */
+#line 371 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) < 2 || (yyvsp[0].i) > 3) {
+				fprintf(stderr, "line (%d) fatal: only AC(2) or AC(3) can be base register\n",
+					line_no);
+				exit(1);
+			}
+			(yyval.i) = ((yyvsp[0].i) == 2) ? ea_AC2REL : ea_AC3REL;
+		}
+#line 2014 "aasm.tab.c"
+    break;
+
+  case 82: /* ac23: AC LPAREN expr RPAREN  */
+#line 380 "tools/aasm.y"
+                {
+			if ((yyvsp[-1].i) < 2 || (yyvsp[-1].i) > 3) {
+				fprintf(stderr, "line (%d) fatal: only AC(2) or AC(3) can be base register\n",
+					line_no);
+				exit(1);
+			}
+			(yyval.i) = ((yyvsp[-1].i) == 2) ? ea_AC2REL : ea_AC3REL;
+		}
+#line 2027 "aasm.tab.c"
+    break;
+
+  case 83: /* SrcAC: expr  */
+#line 391 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) < 0 || (yyvsp[0].i) > 3) {
+				fprintf(stderr, "line (%d) fatal: invalid source AC(%lld)\n",
+					line_no, (yyvsp[0].i));
+				exit(1);
+			}
+			(yyval.i) = (yyvsp[0].i) << 13;
+		}
+#line 2040 "aasm.tab.c"
+    break;
+
+  case 84: /* SrcAC: AC LPAREN IMM RPAREN  */
+#line 400 "tools/aasm.y"
+                {
+			if ((yyvsp[-1].i) < 0 || (yyvsp[-1].i) > 3) {
+				fprintf(stderr, "line (%d) fatal: invalid source AC(%lld)\n",
+					line_no, (yyvsp[-1].i));
+				exit(1);
+			}
+			(yyval.i) = (yyvsp[-1].i) << 13;
+		}
+#line 2053 "aasm.tab.c"
+    break;
+
+  case 85: /* DstAC: expr  */
+#line 411 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) < 0 || (yyvsp[0].i) > 3) {
+				fprintf(stderr, "line (%d) fatal: invalid destination AC(%lld)\n",
+					line_no, (yyvsp[0].i));
+				exit(1);
+			}
+			(yyval.i) = (yyvsp[0].i) << 11;
+		}
+#line 2066 "aasm.tab.c"
+    break;
+
+  case 86: /* DstAC: AC LPAREN expr RPAREN  */
+#line 420 "tools/aasm.y"
+                {
+			if ((yyvsp[-1].i) < 0 || (yyvsp[-1].i) > 3) {
+				fprintf(stderr, "line (%d) fatal: invalid destination AC(%lld)\n",
+					line_no, (yyvsp[-1].i));
+				exit(1);
+			}
+			(yyval.i) = (yyvsp[-1].i) << 11;
+		}
+#line 2079 "aasm.tab.c"
+    break;
+
+  case 87: /* ea: expr  */
+#line 431 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) >= 0 && (yyvsp[0].i) < 256) {
+				/* page 0 address */
+				(yyval.i) = (yyvsp[0].i);
+			} else {
+				int rel = (yyvsp[0].i) - pc - argcnt;
+				/* PC relative */
+				if (pass_no > 1 && (rel < -128 || rel > 127))
+					fprintf(stderr, "line (%d) warning: displacement range (%lld, %d)\n",
+						line_no, (yyvsp[0].i), rel);
+				(yyval.i) = ea_PCREL | (rel & 255);
+			}
+		}
+#line 2097 "aasm.tab.c"
+    break;
+
+  case 88: /* ea: expr ac23  */
+#line 445 "tools/aasm.y"
+                {
+			int rel = (yyvsp[-1].i);
+			if (rel < -128 || rel > 127)
+				fprintf(stderr, "line (%d) warning: displacement range (%lld, %d)\n",
+					line_no, (yyvsp[-1].i), rel);
+			(yyval.i) = (yyvsp[0].i) | (rel & 255);
+		}
+#line 2109 "aasm.tab.c"
+    break;
+
+  case 89: /* ea: expr COMMA ac23  */
+#line 453 "tools/aasm.y"
+                {
+			int rel = (yyvsp[-2].i);
+			if (rel < -128 || rel > 127)
+				fprintf(stderr, "line (%d) warning: displacement range (%lld, %d)\n",
+					line_no, (yyvsp[-2].i), rel);
+			(yyval.i) = (yyvsp[0].i) | (rel & 255);
+		}
+#line 2121 "aasm.tab.c"
+    break;
+
+  case 90: /* disp: expr  */
+#line 463 "tools/aasm.y"
+                {
+			int rel = (yyvsp[0].i) - pc - argcnt;
+			if (pass_no > 1 && (rel < -128 || rel > 127))
+				fprintf(stderr, "line (%d) warning: displacement out of range (%lld)\n",
+					line_no, (yyvsp[0].i) - pc - 1);
+			cmd |= rel & 255;
+		}
+#line 2133 "aasm.tab.c"
+    break;
+
+  case 91: /* rel8: expr  */
+#line 473 "tools/aasm.y"
+                {
+			int rel = (yyvsp[0].i);
+			if (pass_no > 1 && (rel < -128 || rel > 127))
+				fprintf(stderr, "line (%d) warning: displacement out of range (%lld)\n",
+					line_no, (yyvsp[0].i) - pc - 1);
+			cmd |= rel & 255;
+		}
+#line 2145 "aasm.tab.c"
+    break;
+
+  case 92: /* expr: simple  */
+#line 483 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[0].i); }
+#line 2151 "aasm.tab.c"
+    break;
+
+  case 93: /* expr: expr SHL simple  */
+#line 485 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) << (yyvsp[0].i); }
+#line 2157 "aasm.tab.c"
+    break;
+
+  case 94: /* expr: expr SHR simple  */
+#line 487 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) >> (yyvsp[0].i); }
+#line 2163 "aasm.tab.c"
+    break;
+
+  case 95: /* simple: term  */
+#line 491 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[0].i); }
+#line 2169 "aasm.tab.c"
+    break;
+
+  case 96: /* simple: simple PLUS term  */
+#line 493 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) + (yyvsp[0].i); }
+#line 2175 "aasm.tab.c"
+    break;
+
+  case 97: /* simple: simple MINUS term  */
+#line 495 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) - (yyvsp[0].i); }
+#line 2181 "aasm.tab.c"
+    break;
+
+  case 98: /* simple: simple AMPERSAND term  */
+#line 497 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) & (yyvsp[0].i); }
+#line 2187 "aasm.tab.c"
+    break;
+
+  case 99: /* term: factor  */
+#line 501 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[0].i); }
+#line 2193 "aasm.tab.c"
+    break;
+
+  case 100: /* term: PLUS factor  */
+#line 503 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[0].i); }
+#line 2199 "aasm.tab.c"
+    break;
+
+  case 101: /* term: MINUS factor  */
+#line 505 "tools/aasm.y"
+                { (yyval.i) = -(yyvsp[0].i); }
+#line 2205 "aasm.tab.c"
+    break;
+
+  case 102: /* term: TILDE factor  */
+#line 507 "tools/aasm.y"
+                { (yyval.i) = ~(yyvsp[0].i); }
+#line 2211 "aasm.tab.c"
+    break;
+
+  case 103: /* term: term ASTERISK factor  */
+#line 509 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) * (yyvsp[0].i); }
+#line 2217 "aasm.tab.c"
+    break;
+
+  case 104: /* term: term SLASH factor  */
+#line 511 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) / (yyvsp[0].i); }
+#line 2223 "aasm.tab.c"
+    break;
+
+  case 105: /* term: term BAR factor  */
+#line 513 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) | (yyvsp[0].i); }
+#line 2229 "aasm.tab.c"
+    break;
+
+  case 106: /* term: term CARET factor  */
+#line 515 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-2].i) ^ (yyvsp[0].i); }
+#line 2235 "aasm.tab.c"
+    break;
+
+  case 107: /* factor: IMM  */
+#line 519 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[0].i); }
+#line 2241 "aasm.tab.c"
+    break;
+
+  case 108: /* factor: SYM  */
+#line 521 "tools/aasm.y"
+                { (yyval.i) = getsym((yyvsp[0].s)); free((yyvsp[0].s)); }
+#line 2247 "aasm.tab.c"
+    break;
+
+  case 109: /* factor: LPAREN expr RPAREN  */
+#line 523 "tools/aasm.y"
+                { (yyval.i) = (yyvsp[-1].i); }
+#line 2253 "aasm.tab.c"
+    break;
+
+  case 110: /* imm4: expr  */
+#line 527 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) < 0 || (yyvsp[0].i) > 15)
+				fprintf(stderr, "line (%d) warning: bad cycle count (%lld)\n",
+					line_no, (yyvsp[0].i));
+			(yyval.i) = (yyvsp[0].i) & 15;
+		}
+#line 2264 "aasm.tab.c"
+    break;
+
+  case 111: /* imm8: expr  */
+#line 536 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) < -128 || (yyvsp[0].i) > 255)
+				fprintf(stderr, "line (%d) warning: size exceeds 8 bits (%lld)\n",
+					line_no, (yyvsp[0].i));
+			if (arglow)
+				arg[argcnt++] |= (yyvsp[0].i) << 8;
+			else
+				arg[argcnt] = (yyvsp[0].i);
+			arglow ^= 1;
+		}
+#line 2279 "aasm.tab.c"
+    break;
+
+  case 114: /* imm16: expr  */
+#line 553 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) < -32768 || (yyvsp[0].i) > 65535)
+				fprintf(stderr, "line (%d) warning: size exceeds 16 bits (%lld)\n",
+					line_no, (yyvsp[0].i));
+			arg[argcnt++] = (yyvsp[0].i);
+		}
+#line 2290 "aasm.tab.c"
+    break;
+
+  case 117: /* imm32: expr  */
+#line 566 "tools/aasm.y"
+                {
+			if ((yyvsp[0].i) < -2147483648ll || (yyvsp[0].i) > 21474836647ll)
+				fprintf(stderr, "line (%d) warning: size exceeds 32 bits (%lld)\n",
+					line_no, (yyvsp[0].i));
+			arg[argcnt++] = (yyvsp[0].i) % 65536;
+			arg[argcnt++] = (yyvsp[0].i) / 65536;
+		}
+#line 2302 "aasm.tab.c"
+    break;
+
+  case 120: /* str: CHR  */
+#line 580 "tools/aasm.y"
+                {
+			int len = strlen((yyvsp[0].s));
+			int i;
+			for (i = 0; i < len; i++) {
+				if (arglow)
+					arg[argcnt++] |= (yyvsp[0].s)[i] << 8;
+				else
+					arg[argcnt] = (yyvsp[0].s)[i];
+				arglow ^= 1;
+			}
+			free((yyvsp[0].s));
+		}
+#line 2319 "aasm.tab.c"
+    break;
+
+
+#line 2323 "aasm.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 599 "tools/aasm.y"
+
+
+int list(char * fmt, ...)
+{
+	va_list arg;
+	int rc = 0;
+
+	if (!f_list)
+		return rc;
+	if (pass_no < 2)
+		return rc;
+	va_start(arg, fmt);
+	rc = vfprintf(lstfile, fmt, arg);
+	va_end(arg);
+	return rc;
+}
+
+int outw(word c)
+{
+	int rc = 0;
+	if (pass_no == 1) {
+		pc++;
+		return rc;
+	}
+	if (f_octal)
+		rc = list("%06o ", c);
+	else
+		rc = list("%04x ", c);
+	if (f_dump) {
+		if (pc != pcmax || 0 == (pcmax % 4)) {
+			if (-1 != pcmax)
+				fprintf(outfile, "\n");
+			fprintf(outfile, "%07o:", pc);
+			pcmax = pc;
+		}
+		fprintf(outfile, " %07o", c);
+		pcmax = ++pc;
+	} else {
+		if (pc > alloc) {
+			alloc = (pc | 0xffff) + 1;
+			image = (word *)realloc(image, alloc * sizeof(word));
+			if (!image) {
+				fprintf(stderr, "fatal: could not realloc() %d words of memory\n",
+					alloc);
+				exit(1);
+			}
+		}
+		image[pc] = c;
+		pc++;
+		if (pc > pcmax)
+			pcmax = pc;
+	}
+	return rc;
+}
+
+void emit(void)
+{
+	int i;
+	int x = 0;
+
+	if (arglow) {
+		argcnt++;
+		arglow = 0;
+	}
+
+	if (cmdflg || argcnt) {
+		if (f_octal)
+			x += list("%06o: ", pc);
+		else
+			x += list("%04x: ", pc);
+	}
+
+	if (cmdflg)
+		x += outw(cmd);
+	for (i = 0; i < argcnt && i < 4; i++)
+		x += outw(arg[i]);
+	if (strchr(lstbuff, '\n')) {
+		if (!(cmdflg || argcnt) && expflg) {
+			if (f_octal)
+				x += list("=%06o ", eexp);
+			else
+				x += list("=%04x ", eexp);
+		}
+		if (x >= 0 && x < 24)
+			list("%*s", 24 - x, " ");
+		list("%s", lstbuff);
+	}
+	if (argcnt > 4) {
+		for (i = 4; i < argcnt; i++) {
+			if ((i & 3) == 0) {
+				if (f_octal)
+					x = list("%06o: ", pc);
+				else
+					x = list("%04x: ", pc);
+			}
+			x += outw(arg[i]);
+			if ((i & 3) == 3)
+				x += list("\n");
+		}
+		if (i & 3)
+			x += list("\n");
+	}
+	cmd = 0;
+	arg[0] = 0;
+	expflg = 0;
+	cmdflg = 1;
+	argcnt = 0;
+	arglow = 0;
+}
+
+void addsym(char * name, int value)
+{
+	SYM_t *s, *s0, *s1;
+	for (s = sym; (s); s = s->next) {
+		if (strcasecmp(name, s->name) == 0) {
+			if (s->pass_no == pass_no)
+				fprintf(stderr, "line (%d) warning: double defined symbol %s\n",
+					line_no, name);
+			s->line_no[0] = line_no;
+			s->pass_no = pass_no;
+			if (s->value != value)
+				fprintf(stderr, "line (%d) warning: %s has different value on pass 2\n",
+					line_no, name);
+			s->value   = value;
+			return;
+		}
+	}
+	for (s0 = NULL, s1 = sym; (s1); s0 = s1, s1 = s1->next)
+		if (strcasecmp(name, s1->name) <= 0)
+			break;
+	s = (SYM_t *) calloc(1, sizeof(SYM_t));
+	if (!s) {
+		fprintf(stderr, "error: out of memory!\n");
+		exit(1);
+	}
+	s->next = s1;
+	s->pass_no = pass_no;
+	s->refs = 0;
+	s->line_no = malloc(sizeof(int));
+	*s->line_no = line_no;
+	s->value = value;
+	s->name = strdup(name);
+	if (s0)
+		s0->next = s;
+	else
+		sym = s;
+	symb_no++;
+}
+
+int getsym(char * name)
+{
+	SYM_t *s;
+	for (s = sym; (s); s = s->next) {
+		if (strcasecmp(name, s->name) == 0) {
+			if (pass_no > 1) {
+				s->refs += 1;
+				s->line_no = (int *) realloc(s->line_no, (s->refs + 1) * sizeof(int));
+				s->line_no[s->refs] = line_no;
+			}
+			return s->value;
+		}
+	}
+	if (pass_no > 1)
+		fprintf(stderr, "line (%d) undefined symbol: %s\n",
+			line_no, name);
+	return 0;
+}
+
+void prtsym(FILE * filp)
+{
+	SYM_t * s;
+	int i;
+	for (s = sym; (s); s = s->next) {
+		fprintf(filp, "%-32.32s%04X line %d, %d references\n",
+			s->name, s->value, s->line_no[0], s->refs);
+		if (f_xref) {
+			if (s->refs > 0) {
+				for (i = 0; i < s->refs; i++) {
+					if ((i & 7) == 0)
+						fprintf(filp, "\t");
+					if (i > 0)
+						fprintf(filp, ",");
+					fprintf(filp, "%d", s->line_no[i+1]);
+					if ((i & 7) == 7)
+						fprintf(filp,"\n");
+					}
+				if (i & 7)
+					fprintf(filp, "\n");
+			}
+		}
+	}
+}
+
+int main(int ac, char ** av)
+{
+	int i;
+	char * p;
+
+	if (ac < 2) {
+		fprintf(stderr, "usage:\t%s [options] input[.asm] [output[.bin]] [filename[.lst]]\n", av[0]);
+		fprintf(stderr, "options can be one or more of:\n");
+		fprintf(stderr, "-a\tgenerate octal dump instead of binary\n");
+		fprintf(stderr, "-l\tgenerate listing (to file input.lst)\n");
+		fprintf(stderr, "-s\toutput symbol table\n");
+		fprintf(stderr, "-o\tprint octal addresses and opcodes in listing\n");
+		fprintf(stderr, "-x\toutput cross reference with symbol table (implies -s)\n");
+#if	ASM_DEBUG
+		fprintf(stderr, "-d\tgenerate parser debug output to stderr\n");
+#endif
+		exit(1);
+	}
+	for (i = 1; i < ac; i++) {
+		if (av[i][0] == '-') {
+			switch (av[i][1]) {
+			case 'a':
+				f_dump = 1;
+				break;
+			case 'l':
+				f_list = 1;
+				break;
+			case 'h':
+				f_octal = 0;
+				break;
+			case 's':
+				f_syms = 1;
+				break;
+			case 'x':
+				f_syms = 1;
+				f_xref = 1;
+				break;
+			case 'o':
+				if (++i >= ac) {
+					fprintf(stderr, "-o output filename missing\n");
+					exit(1);
+				}
+				snprintf(outname, sizeof(outname), "%s", av[i]);
+				break;
+#if	ASM_DEBUG
+			case 'd':
+				yydebug = 1;
+				break;
+#endif
+			default:
+				fprintf(stderr, "illegal option %s\n", av[i]);
+				exit(1);
+			}
+		} else if (!strlen(inpname)) {
+			snprintf(inpname, sizeof(inpname), "%s", av[i]);
+		} else if (!strlen(outname)) {
+			snprintf(outname, sizeof(outname), "%s", av[i]);
+		} else if (!strlen(lstname)) {
+			snprintf(lstname, sizeof(lstname), "%s", av[i]);
+		} else {
+			fprintf(stderr, "additional argument %s ignored\n", av[i]);
+		}
+	}
+	if (!strlen(inpname)) {
+		fprintf(stderr, "input filename missing!\n");
+		exit(1);
+	}
+	if (!strlen(outname)) {
+		strcpy(outname, inpname);
+		p = strrchr(outname, '.');
+		if (f_dump) {
+			if (p)
+				strcpy(p, ".oct");
+			else
+				strcat(outname, ".oct");
+		} else {
+			if (p)
+				strcpy(p, ".bin");
+			else
+				strcat(outname, ".bin");
+		}
+	}
+	if (f_list) {
+		if (!strlen(lstname)) {
+			strcpy(lstname, inpname);
+			p = strrchr(lstname, '.');
+			if (p)
+				strcpy(p, ".lst");
+			else
+				strcat(lstname, ".lst");
+		}
+	} else if (strlen(lstname)) {
+		f_list = 1;
+		p = strrchr(lstname, '.');
+		if (p)
+			strcpy(p, ".lst");
+		else
+			strcat(lstname, ".lst");
+	}
+	p = strrchr(inpname, '.');
+	if (!p)
+		strcat(inpname, ".asm");
+	inpfile = fopen(inpname, "r");
+	if (!inpfile) {
+		fprintf(stderr, "can't open %s\n", inpname);
+		exit(1);
+	}
+	outfile = fopen(outname, "wb");
+	if (!outfile) {
+		fprintf(stderr, "can't create %s\n", outname);
+		exit(1);
+	}
+	if (f_list) {
+		lstfile = fopen(lstname, "w");
+		if (!lstfile) {
+			fprintf(stderr, "can't create %s\n", outname);
+			exit(1);
+		}
+		plst = lstbuff;
+		*plst = '\0';
+	}
+	printf("assembling %s\npass 1\n", inpname);
+	yyrestart(inpfile);
+	yyparse();
+	list("\n");
+	if (f_syms)
+		prtsym((f_list) ? lstfile : stdout);
+	fclose(inpfile);
+	if (!f_dump) {
+		if (pcmax != fwrite(image, sizeof(word), pcmax, outfile)) {
+			fprintf(stderr, "error writing output %s\n", outname);
+			exit(1);
+		}
+	}
+	fclose(outfile);
+	if (f_list)
+		fclose(lstfile);
+	printf("%d lines, %d symbols\n", line_no, symb_no);
+
+	return 0;
+}
@@ -0,0 +1,252 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_AASM_TAB_H_INCLUDED
+# define YY_YY_AASM_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    EOL = 258,                     /* EOL  */
+    HASH = 259,                    /* HASH  */
+    COMMA = 260,                   /* COMMA  */
+    COLON = 261,                   /* COLON  */
+    LPAREN = 262,                  /* LPAREN  */
+    RPAREN = 263,                  /* RPAREN  */
+    QUOTE = 264,                   /* QUOTE  */
+    PLUS = 265,                    /* PLUS  */
+    MINUS = 266,                   /* MINUS  */
+    ASTERISK = 267,                /* ASTERISK  */
+    SLASH = 268,                   /* SLASH  */
+    SHL = 269,                     /* SHL  */
+    SHR = 270,                     /* SHR  */
+    AMPERSAND = 271,               /* AMPERSAND  */
+    BAR = 272,                     /* BAR  */
+    CARET = 273,                   /* CARET  */
+    TILDE = 274,                   /* TILDE  */
+    AT = 275,                      /* AT  */
+    IMM = 276,                     /* IMM  */
+    REG = 277,                     /* REG  */
+    SYM = 278,                     /* SYM  */
+    CHR = 279,                     /* CHR  */
+    ARITH = 280,                   /* ARITH  */
+    AC = 281,                      /* AC  */
+    SKP = 282,                     /* SKP  */
+    SZC = 283,                     /* SZC  */
+    SNC = 284,                     /* SNC  */
+    SZR = 285,                     /* SZR  */
+    SNR = 286,                     /* SNR  */
+    SEZ = 287,                     /* SEZ  */
+    SBN = 288,                     /* SBN  */
+    JMP = 289,                     /* JMP  */
+    JSR = 290,                     /* JSR  */
+    DSZ = 291,                     /* DSZ  */
+    ISZ = 292,                     /* ISZ  */
+    LDA = 293,                     /* LDA  */
+    STA = 294,                     /* STA  */
+    COM = 295,                     /* COM  */
+    NEG = 296,                     /* NEG  */
+    MOV = 297,                     /* MOV  */
+    INC = 298,                     /* INC  */
+    ADC = 299,                     /* ADC  */
+    SUB = 300,                     /* SUB  */
+    ADD = 301,                     /* ADD  */
+    AND = 302,                     /* AND  */
+    CYCLE = 303,                   /* CYCLE  */
+    MUL = 304,                     /* MUL  */
+    DIV = 305,                     /* DIV  */
+    JSRII = 306,                   /* JSRII  */
+    JSRIS = 307,                   /* JSRIS  */
+    CONVERT = 308,                 /* CONVERT  */
+    DIR = 309,                     /* DIR  */
+    EIR = 310,                     /* EIR  */
+    BRI = 311,                     /* BRI  */
+    RCLK = 312,                    /* RCLK  */
+    SIO = 313,                     /* SIO  */
+    BLT = 314,                     /* BLT  */
+    BLKS = 315,                    /* BLKS  */
+    SIT = 316,                     /* SIT  */
+    JMPRAM = 317,                  /* JMPRAM  */
+    RDRAM = 318,                   /* RDRAM  */
+    WRTRAM = 319,                  /* WRTRAM  */
+    DIRS = 320,                    /* DIRS  */
+    VERS = 321,                    /* VERS  */
+    DREAD = 322,                   /* DREAD  */
+    DWRITE = 323,                  /* DWRITE  */
+    DEXCH = 324,                   /* DEXCH  */
+    DIAGNOSE1 = 325,               /* DIAGNOSE1  */
+    DIAGNOSE2 = 326,               /* DIAGNOSE2  */
+    BITBLT = 327,                  /* BITBLT  */
+    XMLDA = 328,                   /* XMLDA  */
+    XMSTA = 329,                   /* XMSTA  */
+    DB = 330,                      /* DB  */
+    DW = 331,                      /* DW  */
+    DD = 332,                      /* DD  */
+    DS = 333,                      /* DS  */
+    ALIGN = 334,                   /* ALIGN  */
+    END = 335,                     /* END  */
+    EQU = 336,                     /* EQU  */
+    EVEN = 337,                    /* EVEN  */
+    ORG = 338                      /* ORG  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define EOL 258
+#define HASH 259
+#define COMMA 260
+#define COLON 261
+#define LPAREN 262
+#define RPAREN 263
+#define QUOTE 264
+#define PLUS 265
+#define MINUS 266
+#define ASTERISK 267
+#define SLASH 268
+#define SHL 269
+#define SHR 270
+#define AMPERSAND 271
+#define BAR 272
+#define CARET 273
+#define TILDE 274
+#define AT 275
+#define IMM 276
+#define REG 277
+#define SYM 278
+#define CHR 279
+#define ARITH 280
+#define AC 281
+#define SKP 282
+#define SZC 283
+#define SNC 284
+#define SZR 285
+#define SNR 286
+#define SEZ 287
+#define SBN 288
+#define JMP 289
+#define JSR 290
+#define DSZ 291
+#define ISZ 292
+#define LDA 293
+#define STA 294
+#define COM 295
+#define NEG 296
+#define MOV 297
+#define INC 298
+#define ADC 299
+#define SUB 300
+#define ADD 301
+#define AND 302
+#define CYCLE 303
+#define MUL 304
+#define DIV 305
+#define JSRII 306
+#define JSRIS 307
+#define CONVERT 308
+#define DIR 309
+#define EIR 310
+#define BRI 311
+#define RCLK 312
+#define SIO 313
+#define BLT 314
+#define BLKS 315
+#define SIT 316
+#define JMPRAM 317
+#define RDRAM 318
+#define WRTRAM 319
+#define DIRS 320
+#define VERS 321
+#define DREAD 322
+#define DWRITE 323
+#define DEXCH 324
+#define DIAGNOSE1 325
+#define DIAGNOSE2 326
+#define BITBLT 327
+#define XMLDA 328
+#define XMSTA 329
+#define DB 330
+#define DW 331
+#define DD 332
+#define DS 333
+#define ALIGN 334
+#define END 335
+#define EQU 336
+#define EVEN 337
+#define ORG 338
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 82 "tools/aasm.y"
+
+	long long int i;
+	char *s;
+
+#line 238 "aasm.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_AASM_TAB_H_INCLUDED  */
@@ -0,0 +1,1589 @@
+/******************************************
+ * raw PPM files converted to byte arrays
+ ******************************************/
+#include "alto.h"
+
+const uint8_t ppm_green_off[16*16][3] = {
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xde,0xe7,0xe3},{0xda,0xe6,0xe1},
+{0xda,0xe6,0xe1},{0xe6,0xe8,0xe7},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe3,0xe7,0xe5},
+{0xe0,0xe7,0xe4},{0xe5,0xe8,0xe7},{0xde,0xe7,0xe3},{0xe0,0xe7,0xe4},
+{0xd1,0xe5,0xdd},{0xe5,0xe8,0xe6},{0xe6,0xe6,0xe6},{0xd8,0xd8,0xd8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe3,0xe7,0xe5},
+{0xe5,0xe8,0xe7},{0xe4,0xe7,0xe5},{0xd0,0xdc,0xd4},{0xcb,0xd6,0xcd},
+{0xd5,0xda,0xd5},{0xe1,0xe1,0xe1},{0xe1,0xe1,0xe1},{0xb3,0xb3,0xb3},
+{0xce,0xce,0xce},{0xe7,0xe7,0xe7},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe3,0xe7,0xe5},{0xe3,0xe7,0xe5},{0xe8,0xe8,0xe8},
+{0xd2,0xd9,0xd6},{0x84,0xa5,0x87},{0x4e,0x81,0x51},{0x39,0x70,0x39},
+{0x4b,0x78,0x4b},{0x6e,0x8f,0x6e},{0xba,0xc2,0xba},{0xda,0xda,0xda},
+{0xa3,0xa3,0xa3},{0xc9,0xc9,0xc9},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe0,0xe7,0xe4},{0xe5,0xe8,0xe7},{0xcb,0xdf,0xd4},
+{0x55,0x8d,0x5d},{0x2f,0x6c,0x37},{0x1f,0x64,0x35},{0x1c,0x63,0x34},
+{0x1c,0x63,0x34},{0x27,0x68,0x36},{0x3d,0x76,0x41},{0xa4,0xbc,0xaa},
+{0xa7,0xa7,0xa7},{0x94,0x94,0x94},{0xe1,0xe1,0xe1},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe5,0xe8,0xe7},{0xda,0xe5,0xe0},{0x8e,0xab,0x93},
+{0x2f,0x6c,0x37},{0x34,0x7a,0x52},{0x4c,0x88,0x5f},{0x0f,0x5d,0x34},
+{0x0c,0x5c,0x34},{0x0d,0x5c,0x34},{0x20,0x65,0x35},{0x43,0x75,0x43},
+{0xb7,0xb7,0xb7},{0x89,0x89,0x89},{0xc2,0xc2,0xc2},{0xe8,0xe8,0xe8},
+{0xde,0xe7,0xe3},{0xde,0xe7,0xe3},{0xd0,0xdc,0xd4},{0x4e,0x81,0x50},
+{0x1f,0x64,0x35},{0x4f,0x93,0x6e},{0x5c,0x9c,0x78},{0x0f,0x5d,0x34},
+{0x0c,0x5c,0x34},{0x0c,0x5c,0x34},{0x11,0x5e,0x34},{0x33,0x6e,0x37},
+{0x67,0x7e,0x67},{0x81,0x82,0x81},{0x93,0x93,0x93},{0xe8,0xe8,0xe8},
+{0xda,0xe6,0xe1},{0xe0,0xe7,0xe4},{0xcf,0xd8,0xd0},{0x43,0x76,0x43},
+{0x23,0x66,0x34},{0x1f,0x64,0x34},{0x1f,0x64,0x34},{0x1c,0x63,0x34},
+{0x1c,0x63,0x34},{0x1c,0x63,0x34},{0x1e,0x64,0x34},{0x31,0x6d,0x36},
+{0x4c,0x79,0x4c},{0x77,0x84,0x77},{0x85,0x85,0x85},{0xe8,0xe8,0xe8},
+{0xe0,0xe7,0xe4},{0xcf,0xe5,0xdc},{0xce,0xd7,0xd0},{0x40,0x72,0x40},
+{0x38,0x6e,0x38},{0x38,0x6e,0x38},{0x38,0x6e,0x38},{0x38,0x6e,0x38},
+{0x38,0x6c,0x38},{0x38,0x6c,0x38},{0x38,0x6c,0x38},{0x38,0x6f,0x38},
+{0x4d,0x7a,0x4d},{0x64,0x77,0x64},{0x85,0x85,0x85},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe4,0xe8,0xe6},{0xdb,0xdd,0xdc},{0x62,0x82,0x62},
+{0x38,0x6e,0x38},{0x38,0x6c,0x38},{0x38,0x6c,0x38},{0x38,0x6c,0x38},
+{0x38,0x6c,0x38},{0x38,0x6c,0x38},{0x38,0x6d,0x38},{0x34,0x6c,0x36},
+{0x54,0x7e,0x54},{0x64,0x6b,0x64},{0x77,0x82,0x77},{0xe1,0xe1,0xe1},
+{0xe8,0xe8,0xe8},{0xe6,0xe6,0xe6},{0xcf,0xcf,0xcf},{0xaf,0xca,0xb7},
+{0x3f,0x77,0x41},{0x38,0x6e,0x38},{0x38,0x6c,0x38},{0x38,0x6c,0x38},
+{0x38,0x6c,0x38},{0x38,0x6d,0x38},{0x35,0x6d,0x37},{0x44,0x77,0x49},
+{0x64,0x7c,0x64},{0x64,0x65,0x64},{0x6a,0x78,0x6a},{0xc0,0xc0,0xc0},
+{0xe8,0xe8,0xe8},{0xd8,0xd8,0xd8},{0xb3,0xb3,0xb3},{0xc8,0xc8,0xc8},
+{0x9d,0xc2,0xa8},{0x40,0x77,0x42},{0x38,0x6f,0x38},{0x38,0x6e,0x38},
+{0x38,0x6e,0x38},{0x38,0x6d,0x38},{0x46,0x77,0x49},{0x5d,0x80,0x5d},
+{0x64,0x6a,0x64},{0x64,0x68,0x64},{0x65,0x81,0x65},{0xb4,0xbd,0xb4},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xce,0xce,0xce},{0xa3,0xa3,0xa3},
+{0xb1,0xb1,0xb1},{0xaf,0xb5,0xaf},{0x6e,0x99,0x74},{0x46,0x77,0x4a},
+{0x4c,0x7a,0x4c},{0x53,0x7e,0x53},{0x64,0x83,0x64},{0x64,0x6d,0x64},
+{0x64,0x64,0x64},{0x64,0x74,0x64},{0x64,0x88,0x64},{0xaf,0xbf,0xaf},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe7,0xe7,0xe7},{0xdc,0xdc,0xdc},
+{0x8e,0x8e,0x8e},{0x88,0x88,0x88},{0x92,0x97,0x94},{0x6a,0x77,0x6a},
+{0x64,0x77,0x64},{0x64,0x73,0x64},{0x64,0x67,0x64},{0x64,0x68,0x64},
+{0x64,0x74,0x64},{0x64,0x85,0x64},{0x6b,0x8f,0x6d},{0xc4,0xd3,0xc9},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xd8,0xd8,0xd8},{0xb0,0xb0,0xb0},{0xa8,0xa8,0xa8},{0x91,0x91,0x91},
+{0x85,0x85,0x85},{0x7e,0x82,0x7e},{0x69,0x78,0x69},{0x64,0x82,0x64},
+{0x64,0x88,0x64},{0x69,0x89,0x69},{0x9b,0xaa,0x9b},{0xe1,0xe1,0xe1},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe1,0xe1,0xe1},{0xbf,0xc1,0xbf},{0x9d,0xad,0x9d},
+{0xaf,0xbf,0xaf},{0xbf,0xc1,0xbf},{0xe1,0xe1,0xe1},{0xe8,0xe8,0xe8}
+};
+const uint8_t ppm_green_on[16*16][3] = {
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe4,0xe4,0xe4},{0xda,0xda,0xda},{0xda,0xda,0xda},
+{0xda,0xda,0xda},{0xde,0xde,0xde},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe3,0xe3,0xe3},
+{0xd6,0xd6,0xd6},{0xe4,0xe4,0xe4},{0xdd,0xdd,0xdd},{0xda,0xda,0xda},
+{0xc8,0xc8,0xc8},{0xcc,0xcc,0xcc},{0xe0,0xe0,0xe0},{0xd8,0xd8,0xd8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe3,0xe3,0xe3},
+{0xe5,0xe5,0xe5},{0xe4,0xe7,0xe4},{0xce,0xe0,0xce},{0xc6,0xe2,0xc6},
+{0xc9,0xdd,0xc9},{0xd7,0xdf,0xd7},{0xe1,0xe1,0xe1},{0xb3,0xb3,0xb3},
+{0xce,0xce,0xce},{0xe7,0xe7,0xe7},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe3,0xe3,0xe3},{0xe3,0xe3,0xe3},{0xe8,0xe8,0xe8},
+{0xcb,0xda,0xcb},{0x80,0xed,0x80},{0x49,0xee,0x49},{0x38,0xfc,0x38},
+{0x42,0xed,0x42},{0x65,0xed,0x65},{0xaf,0xe3,0xaf},{0xda,0xda,0xda},
+{0xa4,0xa7,0xa4},{0xca,0xcb,0xca},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xd6,0xd6,0xd6},{0xe5,0xe5,0xe5},{0xcb,0xda,0xcb},
+{0x55,0xee,0x55},{0x35,0xfc,0x36},{0x27,0xfc,0x31},{0x24,0xfc,0x30},
+{0x24,0xfc,0x30},{0x30,0xfc,0x34},{0x3f,0xf8,0x3f},{0xa4,0xd8,0xa4},
+{0xa9,0xae,0xa9},{0x97,0x9f,0x97},{0xe1,0xe1,0xe1},{0xe8,0xe8,0xe8},
+{0xe4,0xe4,0xe4},{0xe4,0xe4,0xe4},{0xda,0xdd,0xda},{0x88,0xe1,0x88},
+{0x31,0xfc,0x35},{0x32,0xfb,0x45},{0x3c,0xfa,0x57},{0x24,0xfc,0x30},
+{0x24,0xfc,0x30},{0x25,0xfc,0x30},{0x2e,0xfc,0x33},{0x42,0xf6,0x42},
+{0xb8,0xba,0xb8},{0x8c,0x90,0x8c},{0xc3,0xc3,0xc3},{0xe8,0xe8,0xe8},
+{0xda,0xda,0xda},{0xdd,0xdd,0xdd},{0xce,0xe0,0xce},{0x49,0xee,0x49},
+{0x2c,0xfc,0x33},{0x3c,0xfa,0x57},{0x47,0xf9,0x62},{0x24,0xfc,0x30},
+{0x24,0xfc,0x30},{0x24,0xfc,0x30},{0x26,0xfc,0x31},{0x36,0xfc,0x37},
+{0x6f,0xb2,0x6f},{0x84,0x8c,0x84},{0x96,0x9a,0x96},{0xe8,0xe8,0xe8},
+{0xda,0xda,0xda},{0xda,0xda,0xda},{0xc8,0xdf,0xc8},{0x3e,0xf3,0x3e},
+{0x29,0xfc,0x31},{0x24,0xfc,0x30},{0x24,0xfc,0x30},{0x24,0xfc,0x30},
+{0x24,0xfc,0x30},{0x24,0xfc,0x30},{0x25,0xfc,0x30},{0x33,0xfc,0x36},
+{0x4a,0xc7,0x4a},{0x77,0x84,0x77},{0x87,0x8e,0x87},{0xe8,0xe8,0xe8},
+{0xda,0xda,0xda},{0xc8,0xc8,0xc8},{0xc7,0xe0,0xc7},{0x3c,0xf5,0x3c},
+{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},
+{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},
+{0x51,0xbe,0x51},{0x64,0x78,0x64},{0x87,0x8e,0x87},{0xe8,0xe8,0xe8},
+{0xde,0xde,0xde},{0xcc,0xcc,0xcc},{0xd7,0xdf,0xd7},{0x65,0xed,0x65},
+{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},
+{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x35,0xfc,0x37},
+{0x5c,0xa4,0x5c},{0x64,0x6a,0x64},{0x77,0x86,0x77},{0xe1,0xe1,0xe1},
+{0xe8,0xe8,0xe8},{0xe0,0xe0,0xe0},{0xcf,0xcf,0xcf},{0xaf,0xe3,0xaf},
+{0x3f,0xf8,0x3f},{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x38,0xfc,0x38},
+{0x38,0xfc,0x38},{0x38,0xfc,0x38},{0x35,0xfb,0x37},{0x43,0xc7,0x48},
+{0x64,0x77,0x64},{0x64,0x65,0x64},{0x6a,0x7b,0x6a},{0xc1,0xc5,0xc1},
+{0xe8,0xe8,0xe8},{0xd8,0xd8,0xd8},{0xb3,0xb3,0xb3},{0xc8,0xc8,0xc8},
+{0x9d,0xe0,0x9d},{0x47,0xed,0x47},{0x38,0xfc,0x38},{0x38,0xfc,0x38},
+{0x38,0xfc,0x38},{0x37,0xfc,0x37},{0x46,0xc7,0x49},{0x60,0x90,0x60},
+{0x64,0x6b,0x64},{0x64,0x69,0x64},{0x66,0x7d,0x66},{0xb5,0xbe,0xb5},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xce,0xce,0xce},{0xa4,0xa7,0xa4},
+{0xb2,0xb5,0xb2},{0xac,0xc2,0xac},{0x6e,0xc5,0x6e},{0x44,0xc7,0x48},
+{0x51,0xbe,0x51},{0x5c,0xa4,0x5c},{0x64,0x7e,0x64},{0x64,0x6b,0x64},
+{0x64,0x64,0x64},{0x64,0x73,0x64},{0x64,0x80,0x64},{0xaf,0xbb,0xaf},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe7,0xe7,0xe7},{0xdc,0xdd,0xdc},
+{0x91,0x98,0x91},{0x8b,0x8e,0x8b},{0x92,0x97,0x92},{0x6b,0x7b,0x6b},
+{0x64,0x78,0x64},{0x64,0x73,0x64},{0x64,0x67,0x64},{0x64,0x69,0x64},
+{0x64,0x73,0x64},{0x64,0x7f,0x64},{0x69,0x83,0x69},{0xc0,0xc4,0xc0},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xd8,0xd8,0xd8},{0xb1,0xb1,0xb1},{0xa9,0xa9,0xa9},{0x93,0x97,0x93},
+{0x87,0x8e,0x87},{0x80,0x86,0x80},{0x69,0x7b,0x69},{0x64,0x7d,0x64},
+{0x64,0x80,0x64},{0x69,0x83,0x69},{0x9b,0xa7,0x9b},{0xe1,0xe1,0xe1},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},{0xe8,0xe8,0xe8},
+{0xe8,0xe8,0xe8},{0xe1,0xe1,0xe1},{0xc0,0xc4,0xc0},{0x9d,0xa9,0x9d},
+{0xaf,0xbb,0xaf},{0xc0,0xc4,0xc0},{0xe1,0xe1,0xe1},{0xe8,0xe8,0xe8}
+};
+const uint8_t ppm_led_0[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_1[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_2[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_3[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_4[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_5[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_6[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_7[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_8[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_9[16*16][3] = {
+{0xf9,0xf9,0xf9},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0xf2,0xf2,0xf2},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0x00,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0xec,0xec,0xec},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0x00,0x00,0x00},{0xdf,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0xed,0xed,0xed},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_led_blank[16*16][3] = {
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xd2,0xd2,0xd2},{0xe9,0xe9,0xe9},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0xa5,0xa5,0xa5},{0xd2,0xd2,0xd2},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x7a,0x7a,0x7a},{0xbd,0xbd,0xbd},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x78,0x78,0x78},{0xbc,0xbc,0xbc},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x77,0x77,0x77},{0xbb,0xbb,0xbb},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x79,0x79,0x79},{0xbd,0xbd,0xbd},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},{0x00,0x00,0x00},
+{0x00,0x00,0x00},{0x00,0x00,0x00},{0x85,0x85,0x85},{0xc2,0xc2,0xc2}
+};
+const uint8_t ppm_mng_off[16*16][3] = {
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff}
+};
+const uint8_t ppm_mng_on0[16*16][3] = {
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff}
+};
+const uint8_t ppm_mng_on1[16*16][3] = {
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff}
+};
+const uint8_t ppm_mng_on2[16*16][3] = {
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff}
+};
+const uint8_t ppm_mng_on3[16*16][3] = {
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},
+{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0xbb,0xbb,0xbb},{0x2a,0x2a,0x2a},
+{0x2a,0x2a,0x2a},{0x2a,0x2a,0x2a},{0xff,0xff,0xff},{0xff,0xff,0xff}
+};
+const uint8_t ppm_mouse_off[16*16][3] = {
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbe,0xbe,0xbe},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xc4,0xc4,0xc4},
+{0xd5,0xd5,0xd5},{0xdc,0xdc,0xdc},{0xde,0xde,0xde},{0xcc,0xcc,0xcc},
+{0xbd,0xbd,0xbd},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xdf,0x00,0x00},
+{0xd0,0x4e,0x4e},{0xc0,0xc0,0xc0},{0xcf,0xcf,0xcf},{0xfd,0xfd,0xfd},
+{0xfe,0xfe,0xfe},{0xfe,0xfe,0xfe},{0xf9,0xf9,0xf9},{0xe6,0xe6,0xe6},
+{0xd5,0x53,0x53},{0xdf,0x00,0x00},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xc6,0x85,0x85},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0xde,0x5c,0x5c},{0xf4,0xf4,0xf4},{0xff,0xff,0xff},
+{0x65,0x65,0x65},{0x65,0x65,0x65},{0xff,0xff,0xff},{0xea,0x68,0x68},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xc6,0x85,0x85},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xc9,0x88,0x88},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xec,0x6a,0x6a},{0x65,0x65,0x65},
+{0x65,0x65,0x65},{0xff,0xff,0xff},{0xac,0x2a,0x2a},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0xca,0x89,0x89},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xd4,0xd4,0xd4},
+{0xed,0xac,0xac},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xec,0x6a,0x6a},
+{0xff,0xff,0xff},{0xac,0x2a,0x2a},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xdd,0x9b,0x9b},{0xc1,0xc1,0xc1},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbf,0xbf,0xbf},{0xe7,0xe7,0xe7},
+{0xfc,0xfc,0xfc},{0xf5,0xb3,0xb3},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xe5,0x2c,0x2c},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xf0,0xae,0xae},
+{0xd8,0xd8,0xd8},{0xc0,0xc0,0xc0},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbd,0xbd,0xbd},{0xcb,0xcb,0xcb},{0xed,0xed,0xed},
+{0xff,0xff,0xff},{0xff,0xff,0xff},{0xf6,0xb4,0xb4},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xf5,0xb3,0xb3},{0xf6,0xf6,0xf6},
+{0xcf,0xcf,0xcf},{0xbe,0xbe,0xbe},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xd7,0xd7,0xd7},{0xf7,0xf7,0xf7},
+{0xff,0xff,0xff},{0xff,0xff,0xff},{0xec,0x6a,0x6a},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xea,0x68,0x68},{0xee,0xee,0xee},
+{0xbd,0xbd,0xbd},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbe,0xbe,0xbe},{0xdb,0xdb,0xdb},{0xf7,0xf7,0xf7},
+{0xff,0xff,0xff},{0xec,0x6a,0x6a},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xef,0x7f,0x7f},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xd9,0x58,0x58},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xc0,0xc0,0xc0},{0xd7,0xd7,0xd7},{0xf8,0xf8,0xf8},
+{0xeb,0x6a,0x6a},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xf5,0xb4,0xb4},
+{0xfd,0xfd,0xfd},{0xea,0xa9,0xa9},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xd0,0x4e,0x4e},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xc0,0xc0,0xc0},{0xd2,0xd2,0xd2},{0xac,0x2a,0x2a},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xf5,0xb3,0xb3},{0xf8,0xf8,0xf8},
+{0xed,0xed,0xed},{0xd8,0xd8,0xd8},{0xcc,0x8a,0x8a},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0xd0,0x4e,0x4e},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0x65,0x65,0x65},{0xac,0x2a,0x2a},{0xdf,0x00,0x00},
+{0xdf,0x00,0x00},{0xe9,0xa7,0xa7},{0xec,0xec,0xec},{0xe1,0xe1,0xe1},
+{0xd3,0xd3,0xd3},{0xc5,0xc5,0xc5},{0xbd,0xbd,0xbd},{0xc6,0x85,0x85},
+{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xd0,0x4e,0x4e},{0xbc,0xbc,0xbc},
+{0x65,0x65,0x65},{0x65,0x65,0x65},{0xdf,0x00,0x00},{0xdf,0x00,0x00},
+{0xd7,0x96,0x96},{0xd4,0xd4,0xd4},{0xcc,0xcc,0xcc},{0xc4,0xc4,0xc4},
+{0xbd,0xbd,0xbd},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xc6,0x85,0x85},{0xdf,0x00,0x00},{0xdf,0x00,0x00},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xc7,0x86,0x86},
+{0xc0,0xc0,0xc0},{0xc0,0xc0,0xc0},{0xbf,0xbf,0xbf},{0xbd,0xbd,0xbd},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xc6,0x85,0x85},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc}
+};
+const uint8_t ppm_mouse_on[16*16][3] = {
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbe,0xbe,0xbe},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xc4,0xc4,0xc4},
+{0xd5,0xd5,0xd5},{0xdc,0xdc,0xdc},{0xde,0xde,0xde},{0xcc,0xcc,0xcc},
+{0xbd,0xbd,0xbd},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xc0,0xc0,0xc0},{0xcf,0xcf,0xcf},{0xfd,0xfd,0xfd},
+{0xfe,0xfe,0xfe},{0xfe,0xfe,0xfe},{0xf9,0xf9,0xf9},{0xe6,0xe6,0xe6},
+{0xc8,0xc8,0xc8},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbf,0xbf,0xbf},{0xde,0xde,0xde},{0xf4,0xf4,0xf4},{0xff,0xff,0xff},
+{0x65,0x65,0x65},{0x65,0x65,0x65},{0xff,0xff,0xff},{0xfa,0xfa,0xfa},
+{0xda,0xda,0xda},{0xbf,0xbf,0xbf},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xc0,0xc0,0xc0},
+{0xdb,0xdb,0xdb},{0xfa,0xfa,0xfa},{0xff,0xff,0xff},{0x65,0x65,0x65},
+{0x65,0x65,0x65},{0xff,0xff,0xff},{0x65,0x65,0x65},{0xfc,0xfc,0xfc},
+{0xdf,0xdf,0xdf},{0xc2,0xc2,0xc2},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xd4,0xd4,0xd4},
+{0xf3,0xf3,0xf3},{0xfe,0xfe,0xfe},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x65,0x65,0x65},{0x65,0x65,0x65},{0xfd,0xfd,0xfd},
+{0xdc,0xdc,0xdc},{0xc1,0xc1,0xc1},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbf,0xbf,0xbf},{0xe7,0xe7,0xe7},
+{0xfc,0xfc,0xfc},{0xfe,0xfe,0xfe},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0x65,0x65,0x65},{0xff,0xff,0xff},{0xf7,0xf7,0xf7},
+{0xd8,0xd8,0xd8},{0xc0,0xc0,0xc0},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbd,0xbd,0xbd},{0xcb,0xcb,0xcb},{0xed,0xed,0xed},
+{0xff,0xff,0xff},{0xff,0xff,0xff},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0xfe,0xfe,0xfe},{0xfe,0xfe,0xfe},{0xf6,0xf6,0xf6},
+{0xcf,0xcf,0xcf},{0xbe,0xbe,0xbe},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xd7,0xd7,0xd7},{0xf7,0xf7,0xf7},
+{0xff,0xff,0xff},{0xff,0xff,0xff},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0xfe,0xfe,0xfe},{0xfb,0xfb,0xfb},{0xee,0xee,0xee},
+{0xbd,0xbd,0xbd},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbe,0xbe,0xbe},{0xdb,0xdb,0xdb},{0xf7,0xf7,0xf7},
+{0xff,0xff,0xff},{0xff,0xff,0xff},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xff,0xff,0xff},{0xfc,0xfc,0xfc},{0xee,0xee,0xee},{0xd3,0xd3,0xd3},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xc0,0xc0,0xc0},{0xd7,0xd7,0xd7},{0xf8,0xf8,0xf8},
+{0xfe,0xfe,0xfe},{0xff,0xff,0xff},{0xff,0xff,0xff},{0xff,0xff,0xff},
+{0xfd,0xfd,0xfd},{0xef,0xef,0xef},{0xd5,0xd5,0xd5},{0xc1,0xc1,0xc1},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xc0,0xc0,0xc0},{0xd2,0xd2,0xd2},{0x65,0x65,0x65},
+{0xfb,0xfb,0xfb},{0xfb,0xfb,0xfb},{0xfe,0xfe,0xfe},{0xf8,0xf8,0xf8},
+{0xed,0xed,0xed},{0xd8,0xd8,0xd8},{0xc4,0xc4,0xc4},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0x65,0x65,0x65},{0x65,0x65,0x65},{0x65,0x65,0x65},
+{0xeb,0xeb,0xeb},{0xed,0xed,0xed},{0xec,0xec,0xec},{0xe1,0xe1,0xe1},
+{0xd3,0xd3,0xd3},{0xc5,0xc5,0xc5},{0xbd,0xbd,0xbd},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0x65,0x65,0x65},{0x65,0x65,0x65},{0xbc,0xbc,0xbc},{0xc9,0xc9,0xc9},
+{0xd4,0xd4,0xd4},{0xd4,0xd4,0xd4},{0xcc,0xcc,0xcc},{0xc4,0xc4,0xc4},
+{0xbd,0xbd,0xbd},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbe,0xbe,0xbe},
+{0xc0,0xc0,0xc0},{0xc0,0xc0,0xc0},{0xbf,0xbf,0xbf},{0xbd,0xbd,0xbd},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},
+{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc},{0xbc,0xbc,0xbc}
+};
+const uint8_t ppm_red_off[16*16][3] = {
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xe7,0xdd,0xde},{0xe5,0xd9,0xda},
+{0xe5,0xd9,0xda},{0xeb,0xe6,0xe6},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xe9,0xe2,0xe3},
+{0xe8,0xdf,0xe0},{0xeb,0xe5,0xe5},{0xe7,0xdd,0xde},{0xe8,0xde,0xe0},
+{0xe1,0xce,0xd1},{0xea,0xe4,0xe5},{0xea,0xe6,0xe6},{0xdb,0xd8,0xd8},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xe9,0xe2,0xe3},
+{0xeb,0xe5,0xe5},{0xeb,0xe4,0xe5},{0xe0,0xcd,0xcf},{0xdf,0xcd,0xcd},
+{0xe1,0xd3,0xd3},{0xe6,0xe0,0xe0},{0xe5,0xe1,0xe1},{0xb4,0xb3,0xb3},
+{0xce,0xcb,0xcb},{0xeb,0xe7,0xe7},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xe9,0xe2,0xe3},{0xe9,0xe2,0xe3},{0xec,0xe8,0xe8},
+{0xd9,0xd1,0xd2},{0xbf,0x8b,0x8d},{0xa8,0x49,0x4b},{0xa3,0x3f,0x3f},
+{0xa2,0x44,0x44},{0xaf,0x71,0x71},{0xcc,0xbe,0xbe},{0xdd,0xda,0xda},
+{0x9c,0x96,0x96},{0xce,0xcb,0xcb},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xe8,0xdf,0xe0},{0xeb,0xe5,0xe5},{0xe0,0xc9,0xcd},
+{0xb1,0x53,0x57},{0x9b,0x35,0x37},{0x89,0x30,0x37},{0x7d,0x2f,0x3d},
+{0x7d,0x2f,0x3d},{0x92,0x32,0x38},{0xa5,0x3e,0x3f},{0xc8,0xa3,0xa6},
+{0xb4,0xb0,0xb0},{0xa6,0x9e,0x9e},{0xe5,0xe1,0xe1},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xeb,0xe5,0xe5},{0xe5,0xd8,0xda},{0xc1,0x88,0x8b},
+{0x99,0x36,0x37},{0x94,0x49,0x4f},{0xa3,0x5e,0x64},{0x79,0x29,0x39},
+{0x78,0x28,0x38},{0x79,0x28,0x38},{0x8c,0x30,0x37},{0xa4,0x4b,0x4b},
+{0xbc,0xb8,0xb8},{0x90,0x8a,0x8a},{0xc5,0xc2,0xc2},{0xec,0xe8,0xe8},
+{0xe7,0xdd,0xde},{0xe7,0xdd,0xde},{0xe0,0xcd,0xcf},{0xa8,0x49,0x4b},
+{0x87,0x30,0x38},{0xa7,0x69,0x6d},{0xbc,0x83,0x8e},{0x79,0x29,0x39},
+{0x78,0x28,0x38},{0x78,0x28,0x38},{0x7d,0x2a,0x38},{0x9f,0x37,0x37},
+{0x9b,0x75,0x75},{0x8f,0x88,0x88},{0x9f,0x9a,0x9a},{0xec,0xe8,0xe8},
+{0xe5,0xd9,0xda},{0xe8,0xde,0xe0},{0xdf,0xcd,0xcd},{0xa3,0x3f,0x3f},
+{0x8a,0x32,0x38},{0x81,0x33,0x3f},{0x86,0x30,0x39},{0x88,0x2f,0x36},
+{0x83,0x2f,0x39},{0x80,0x2f,0x3b},{0x8a,0x30,0x35},{0x9d,0x36,0x36},
+{0x8e,0x54,0x54},{0x7a,0x77,0x77},{0x91,0x89,0x89},{0xec,0xe8,0xe8},
+{0xe8,0xdf,0xe0},{0xe0,0xcc,0xcf},{0xe0,0xcc,0xcd},{0xa3,0x3d,0x3d},
+{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},
+{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},
+{0x92,0x55,0x55},{0x6f,0x6e,0x6e},{0x91,0x89,0x89},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xea,0xe4,0xe4},{0xe3,0xdc,0xdc},{0xa9,0x69,0x69},
+{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},
+{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0x9c,0x36,0x36},
+{0x8d,0x69,0x69},{0x6f,0x6e,0x6e},{0x7d,0x7c,0x7c},{0xe2,0xdd,0xdd},
+{0xec,0xe8,0xe8},{0xea,0xe6,0xe6},{0xd1,0xcf,0xcf},{0xd5,0xb2,0xb6},
+{0xa7,0x3f,0x40},{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa4,0x38,0x38},
+{0xa4,0x38,0x38},{0xa4,0x38,0x38},{0xa1,0x38,0x38},{0x99,0x47,0x47},
+{0x78,0x76,0x76},{0x6d,0x6d,0x6d},{0x73,0x71,0x71},{0xc4,0xbd,0xbd},
+{0xec,0xe8,0xe8},{0xdb,0xd8,0xd8},{0xb4,0xb3,0xb3},{0xca,0xc8,0xc8},
+{0xcf,0x9b,0xa0},{0xa6,0x48,0x49},{0xa4,0x38,0x38},{0xa4,0x38,0x38},
+{0xa4,0x38,0x38},{0x9c,0x36,0x36},{0x99,0x47,0x47},{0x7f,0x6f,0x6f},
+{0x6c,0x6c,0x6c},{0x6c,0x6c,0x6c},{0x7b,0x78,0x78},{0xc0,0xba,0xba},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xce,0xcb,0xcb},{0x9c,0x96,0x96},
+{0xb9,0xb6,0xb6},{0xba,0xac,0xac},{0xa4,0x6c,0x6c},{0x8f,0x53,0x53},
+{0x8f,0x54,0x54},{0x8c,0x69,0x69},{0x7a,0x77,0x77},{0x71,0x70,0x70},
+{0x6c,0x6c,0x6c},{0x72,0x71,0x71},{0x80,0x7c,0x7c},{0xbe,0xba,0xba},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xeb,0xe7,0xe7},{0xe1,0xdd,0xdd},
+{0x9a,0x93,0x93},{0x8d,0x88,0x88},{0x91,0x8a,0x8a},{0x7a,0x77,0x77},
+{0x6f,0x6e,0x6e},{0x6f,0x6e,0x6e},{0x6d,0x6d,0x6d},{0x6c,0x6c,0x6c},
+{0x72,0x71,0x71},{0x7c,0x79,0x79},{0x84,0x80,0x80},{0xc9,0xc5,0xc5},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xd8,0xd4,0xd4},{0xb1,0xaf,0xaf},{0xa8,0xa6,0xa6},{0x94,0x8d,0x8d},
+{0x91,0x89,0x89},{0x85,0x82,0x82},{0x74,0x73,0x73},{0x7a,0x77,0x77},
+{0x80,0x7c,0x7c},{0x84,0x80,0x80},{0xa0,0x9b,0x9b},{0xe5,0xe1,0xe1},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},{0xec,0xe8,0xe8},
+{0xec,0xe8,0xe8},{0xe5,0xe1,0xe1},{0xc9,0xc5,0xc5},{0xaa,0xa7,0xa7},
+{0xbe,0xba,0xba},{0xc9,0xc5,0xc5},{0xe5,0xe1,0xe1},{0xec,0xe8,0xe8}
+};
+const uint8_t ppm_red_on[16*16][3] = {
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xeb,0xe1,0xe4},{0xdf,0xd8,0xda},{0xdf,0xd8,0xda},
+{0xdf,0xd8,0xda},{0xe4,0xdb,0xde},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xe9,0xdf,0xe3},
+{0xd9,0xd4,0xd6},{0xeb,0xe1,0xe4},{0xe2,0xda,0xdd},{0xdf,0xd8,0xda},
+{0xc8,0xc8,0xc8},{0xcd,0xcb,0xcc},{0xe7,0xdd,0xe0},{0xde,0xd5,0xd8},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xe9,0xdf,0xe3},
+{0xed,0xe2,0xe5},{0xef,0xe1,0xe4},{0xe5,0xcb,0xce},{0xe6,0xc3,0xc6},
+{0xe1,0xc7,0xc9},{0xe4,0xd7,0xd9},{0xe8,0xde,0xe1},{0xb4,0xb3,0xb3},
+{0xcf,0xc9,0xcb},{0xef,0xe3,0xe7},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xe9,0xdf,0xe3},{0xe9,0xdf,0xe3},{0xf0,0xe4,0xe8},
+{0xdb,0xcf,0xd1},{0xee,0x81,0x82},{0xee,0x49,0x49},{0xfc,0x38,0x38},
+{0xed,0x42,0x42},{0xeb,0x6b,0x6b},{0xe4,0xb6,0xb8},{0xe0,0xd7,0xda},
+{0x96,0x96,0x96},{0xcf,0xc9,0xcb},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xd9,0xd4,0xd6},{0xed,0xe2,0xe5},{0xde,0xc9,0xcb},
+{0xee,0x55,0x55},{0xfc,0x37,0x37},{0xfc,0x32,0x34},{0xfc,0x2c,0x30},
+{0xfc,0x2f,0x32},{0xfc,0x34,0x36},{0xf8,0x3f,0x3f},{0xe0,0xa2,0xa3},
+{0xb2,0xaf,0xb0},{0xa1,0x9e,0x9e},{0xe8,0xde,0xe1},{0xf0,0xe4,0xe8},
+{0xeb,0xe1,0xe4},{0xeb,0xe1,0xe4},{0xe2,0xd7,0xda},{0xe4,0x86,0x88},
+{0xfc,0x37,0x37},{0xfb,0x3f,0x46},{0xfa,0x4b,0x55},{0xfc,0x2c,0x30},
+{0xfc,0x2c,0x30},{0xfc,0x2c,0x30},{0xfc,0x33,0x35},{0xf7,0x41,0x41},
+{0xbe,0xba,0xbb},{0x91,0x8c,0x8d},{0xc8,0xc1,0xc3},{0xf0,0xe4,0xe8},
+{0xdf,0xd8,0xda},{0xe2,0xda,0xdd},{0xe5,0xcb,0xce},{0xee,0x49,0x49},
+{0xfc,0x2e,0x31},{0xfa,0x4b,0x55},{0xee,0x62,0x66},{0xfc,0x2c,0x30},
+{0xfc,0x2c,0x30},{0xfc,0x2c,0x30},{0xfc,0x2e,0x31},{0xfc,0x38,0x38},
+{0xb4,0x75,0x75},{0x8b,0x88,0x88},{0x9e,0x9b,0x9b},{0xf0,0xe4,0xe8},
+{0xdf,0xd8,0xda},{0xdf,0xd8,0xda},{0xe3,0xc5,0xc8},{0xf3,0x3e,0x3e},
+{0xfc,0x2f,0x31},{0xfc,0x2c,0x30},{0xfc,0x2d,0x30},{0xfc,0x31,0x32},
+{0xfc,0x2f,0x31},{0xfc,0x2c,0x30},{0xfc,0x30,0x32},{0xfc,0x36,0x36},
+{0xce,0x4a,0x4a},{0x86,0x71,0x71},{0x8d,0x89,0x89},{0xf0,0xe4,0xe8},
+{0xdf,0xd8,0xda},{0xc8,0xc8,0xc8},{0xe4,0xc5,0xc7},{0xf5,0x3c,0x3c},
+{0xfc,0x36,0x36},{0xfc,0x36,0x36},{0xfc,0x36,0x36},{0xfc,0x36,0x36},
+{0xfc,0x34,0x34},{0xfc,0x34,0x34},{0xfc,0x34,0x34},{0xfc,0x37,0x37},
+{0xc5,0x51,0x51},{0x86,0x66,0x66},{0x8d,0x89,0x89},{0xf0,0xe4,0xe8},
+{0xe4,0xdb,0xde},{0xcd,0xcb,0xcc},{0xe5,0xd4,0xd7},{0xee,0x64,0x65},
+{0xfc,0x36,0x36},{0xfc,0x34,0x34},{0xfc,0x34,0x34},{0xfc,0x34,0x34},
+{0xfc,0x34,0x34},{0xfc,0x34,0x34},{0xfc,0x35,0x35},{0xfc,0x35,0x35},
+{0xad,0x5c,0x5c},{0x74,0x6a,0x6a},{0x7d,0x7b,0x7c},{0xe4,0xda,0xdd},
+{0xf0,0xe4,0xe8},{0xe7,0xdd,0xe0},{0xd3,0xcd,0xcf},{0xe8,0xac,0xaf},
+{0xf8,0x3f,0x3f},{0xfc,0x36,0x36},{0xfc,0x34,0x34},{0xfc,0x34,0x34},
+{0xfc,0x34,0x34},{0xfc,0x35,0x35},{0xfb,0x35,0x35},{0xce,0x47,0x48},
+{0x85,0x66,0x66},{0x6d,0x6c,0x6c},{0x7f,0x6c,0x6c},{0xc3,0xbb,0xbd},
+{0xf0,0xe4,0xe8},{0xde,0xd5,0xd8},{0xb4,0xb3,0xb3},{0xcb,0xc6,0xc8},
+{0xe3,0x9b,0x9d},{0xed,0x47,0x47},{0xfc,0x37,0x37},{0xfc,0x36,0x36},
+{0xfc,0x36,0x36},{0xfc,0x35,0x35},{0xce,0x47,0x48},{0x9d,0x60,0x60},
+{0x75,0x6a,0x6a},{0x72,0x6b,0x6b},{0x8b,0x67,0x67},{0xc5,0xb2,0xb5},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xcf,0xc9,0xcb},{0x96,0x96,0x96},
+{0xb8,0xb5,0xb6},{0xc4,0xab,0xac},{0xc8,0x71,0x71},{0xce,0x46,0x47},
+{0xc5,0x51,0x51},{0xad,0x5c,0x5c},{0x8e,0x64,0x64},{0x75,0x6a,0x6a},
+{0x6c,0x6c,0x6c},{0x7f,0x68,0x68},{0x90,0x64,0x64},{0xc7,0xad,0xaf},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xef,0xe3,0xe7},{0xe4,0xda,0xdd},
+{0x94,0x93,0x93},{0x8d,0x8a,0x8a},{0x8e,0x8b,0x8b},{0x86,0x71,0x71},
+{0x86,0x66,0x66},{0x74,0x6a,0x6a},{0x70,0x6b,0x6b},{0x6c,0x6c,0x6c},
+{0x7f,0x68,0x68},{0x8f,0x64,0x64},{0x91,0x6b,0x6b},{0xcb,0xc1,0xc4},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xda,0xd1,0xd4},{0xb2,0xaf,0xb0},{0xa9,0xa6,0xa7},{0x90,0x8c,0x8d},
+{0x8d,0x89,0x89},{0x8c,0x82,0x82},{0x87,0x6d,0x6d},{0x86,0x66,0x66},
+{0x90,0x64,0x64},{0x91,0x6b,0x6b},{0xa4,0x90,0x91},{0xe8,0xde,0xe1},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},{0xf0,0xe4,0xe8},
+{0xf0,0xe4,0xe8},{0xe8,0xde,0xe1},{0xcb,0xc1,0xc4},{0xb2,0x9c,0x9d},
+{0xc7,0xad,0xaf},{0xcb,0xc1,0xc4},{0xe8,0xde,0xe1},{0xf0,0xe4,0xe8}
+};
+const uint8_t ppm_yellow_off[16*16][3] = {
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xe4,0xe1,0xe1},{0xda,0xd8,0xd8},{0xda,0xd8,0xd8},
+{0xda,0xd8,0xd8},{0xde,0xdb,0xdb},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe3,0xdf,0xdf},
+{0xd6,0xd4,0xd4},{0xe4,0xe1,0xe1},{0xdd,0xda,0xda},{0xda,0xd8,0xd8},
+{0xc8,0xc8,0xc8},{0xcc,0xcb,0xcb},{0xe0,0xdd,0xdd},{0xd8,0xd5,0xd5},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe3,0xdf,0xdf},
+{0xe5,0xe2,0xe2},{0xe6,0xe1,0xe1},{0xd7,0xce,0xcd},{0xd4,0xc8,0xc6},
+{0xd4,0xca,0xc9},{0xdb,0xd7,0xd7},{0xe1,0xde,0xde},{0xb3,0xb3,0xb3},
+{0xcd,0xca,0xc9},{0xe7,0xe3,0xe3},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xe3,0xdf,0xdf},{0xe3,0xdf,0xdf},{0xe8,0xe4,0xe4},
+{0xd2,0xd0,0xd0},{0xb8,0x94,0x8a},{0xa0,0x61,0x4e},{0x9f,0x57,0x3f},
+{0x9d,0x5b,0x48},{0xac,0x7f,0x71},{0xc9,0xbd,0xbc},{0xda,0xd7,0xd7},
+{0xad,0x9c,0x96},{0xcd,0xca,0xc9},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xd6,0xd4,0xd4},{0xe5,0xe2,0xe2},{0xd1,0xcb,0xc9},
+{0xa4,0x6a,0x55},{0x9a,0x51,0x37},{0x88,0x4a,0x33},{0x86,0x49,0x32},
+{0x86,0x49,0x32},{0x92,0x4e,0x36},{0xa0,0x59,0x3f},{0xbe,0xaa,0xa3},
+{0xb1,0xad,0xaa},{0xa8,0xa0,0x9b},{0xe1,0xde,0xde},{0xe8,0xe4,0xe4},
+{0xe4,0xe1,0xe1},{0xe4,0xe1,0xe1},{0xdb,0xd8,0xd7},{0xb7,0x92,0x88},
+{0x97,0x50,0x36},{0x91,0x5f,0x52},{0xa2,0x72,0x68},{0x78,0x44,0x34},
+{0x78,0x44,0x34},{0x79,0x44,0x34},{0x8e,0x4c,0x35},{0xa0,0x5f,0x4b},
+{0xc8,0xc2,0xc0},{0x90,0x8f,0x8b},{0xc3,0xc1,0xc0},{0xe8,0xe4,0xe4},
+{0xda,0xd8,0xd8},{0xdd,0xda,0xda},{0xd7,0xce,0xcd},{0xa0,0x61,0x4e},
+{0x8a,0x4b,0x35},{0x9e,0x78,0x72},{0xaf,0x94,0x8c},{0x78,0x44,0x34},
+{0x78,0x44,0x34},{0x78,0x44,0x34},{0x7d,0x46,0x34},{0x9e,0x53,0x37},
+{0xac,0x87,0x7d},{0x99,0x8f,0x89},{0xa4,0x9d,0x99},{0xe8,0xe4,0xe4},
+{0xda,0xd8,0xd8},{0xda,0xd8,0xd8},{0xd4,0xc9,0xc7},{0x9e,0x59,0x43},
+{0x8a,0x4a,0x33},{0x7a,0x45,0x34},{0x82,0x47,0x32},{0x86,0x49,0x32},
+{0x80,0x47,0x33},{0x78,0x44,0x34},{0x83,0x48,0x32},{0x99,0x51,0x35},
+{0x9b,0x5a,0x4a},{0x82,0x76,0x74},{0x89,0x89,0x86},{0xe8,0xe4,0xe4},
+{0xda,0xd8,0xd8},{0xc8,0xc8,0xc8},{0xd4,0xc8,0xc5},{0x9f,0x56,0x3d},
+{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},
+{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},
+{0x9c,0x5c,0x4a},{0x72,0x6b,0x6b},{0x89,0x89,0x86},{0xe8,0xe4,0xe4},
+{0xde,0xdb,0xdb},{0xcc,0xcb,0xcb},{0xdb,0xd5,0xd4},{0xab,0x79,0x69},
+{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},
+{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0x9c,0x50,0x35},
+{0x9a,0x63,0x5b},{0x72,0x6b,0x6b},{0x7d,0x7c,0x7b},{0xe1,0xdb,0xda},
+{0xe8,0xe4,0xe4},{0xe0,0xdd,0xdd},{0xcf,0xcd,0xcd},{0xc8,0xb6,0xb1},
+{0xa1,0x5a,0x3f},{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0xa0,0x54,0x38},
+{0xa0,0x54,0x38},{0xa0,0x54,0x38},{0x9c,0x50,0x36},{0x96,0x5a,0x48},
+{0x87,0x6a,0x67},{0x6e,0x6c,0x6c},{0x74,0x70,0x6e},{0xc1,0xbc,0xba},
+{0xe8,0xe4,0xe4},{0xd8,0xd5,0xd5},{0xb3,0xb3,0xb3},{0xc8,0xc6,0xc6},
+{0xbd,0xa4,0x9b},{0xa0,0x5d,0x48},{0xa0,0x54,0x38},{0xa0,0x54,0x38},
+{0xa0,0x54,0x38},{0x9c,0x4f,0x35},{0x95,0x59,0x48},{0x8a,0x68,0x64},
+{0x6c,0x6c,0x6c},{0x6c,0x6c,0x6c},{0x8a,0x6b,0x68},{0xc1,0xb3,0xb2},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xcd,0xca,0xc9},{0xad,0x9c,0x96},
+{0xbd,0xb7,0xb5},{0xca,0xc0,0xbf},{0xa8,0x79,0x6b},{0x9a,0x58,0x49},
+{0x99,0x5b,0x49},{0x99,0x63,0x5b},{0x8b,0x69,0x66},{0x77,0x6b,0x6a},
+{0x6c,0x6c,0x6c},{0x79,0x6b,0x6a},{0x98,0x68,0x64},{0xc6,0xaf,0xad},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe7,0xe3,0xe3},{0xe0,0xdb,0xda},
+{0x94,0x90,0x8c},{0x8b,0x8a,0x86},{0x99,0x8f,0x89},{0x82,0x76,0x74},
+{0x72,0x6b,0x6b},{0x72,0x6b,0x6b},{0x6e,0x6c,0x6c},{0x6c,0x6c,0x6c},
+{0x79,0x6b,0x6a},{0x90,0x69,0x65},{0x9b,0x6f,0x6b},{0xce,0xc3,0xc1},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xd8,0xd2,0xd1},{0xb1,0xaf,0xae},{0xa9,0xa7,0xa5},{0x94,0x8e,0x8b},
+{0x89,0x89,0x86},{0x83,0x82,0x80},{0x78,0x71,0x70},{0x8b,0x69,0x66},
+{0x98,0x68,0x64},{0x9b,0x6f,0x6b},{0xaf,0x94,0x90},{0xe1,0xde,0xde},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},{0xe8,0xe4,0xe4},
+{0xe8,0xe4,0xe4},{0xe1,0xdb,0xda},{0xcd,0xc0,0xbd},{0xc6,0xaf,0xad},
+{0xc6,0xaf,0xad},{0xce,0xc3,0xc1},{0xe1,0xde,0xde},{0xe8,0xe4,0xe4}
+};
+const uint8_t ppm_yellow_on[16*16][3] = {
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xeb,0xeb,0xe4},{0xdf,0xdf,0xda},{0xdf,0xdf,0xda},
+{0xdf,0xdf,0xda},{0xe4,0xe4,0xde},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xe9,0xe9,0xe3},
+{0xd9,0xd9,0xd6},{0xeb,0xeb,0xe4},{0xe2,0xe2,0xdd},{0xdf,0xdf,0xda},
+{0xc8,0xc8,0xc8},{0xcd,0xcd,0xcc},{0xe7,0xe7,0xe0},{0xde,0xde,0xd8},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xe9,0xe9,0xe3},
+{0xed,0xed,0xe5},{0xee,0xee,0xe5},{0xe4,0xe4,0xd0},{0xe6,0xe6,0xc6},
+{0xe4,0xe3,0xca},{0xe4,0xe4,0xd8},{0xe8,0xe8,0xe1},{0xb4,0xb4,0xb3},
+{0xd2,0xd2,0xce},{0xef,0xef,0xe7},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xe9,0xe9,0xe3},{0xe9,0xe9,0xe3},{0xf0,0xf0,0xe8},
+{0xda,0xda,0xce},{0xec,0xec,0x82},{0xed,0xec,0x50},{0xfc,0xfc,0x38},
+{0xf4,0xf3,0x44},{0xec,0xec,0x66},{0xe2,0xe2,0xb2},{0xe0,0xe0,0xda},
+{0xaa,0xa6,0xa5},{0xd0,0xcf,0xca},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xd9,0xd9,0xd6},{0xed,0xed,0xe5},{0xda,0xda,0xce},
+{0xe8,0xe8,0x59},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xf7,0xf7,0x40},{0xe6,0xe6,0xb5},
+{0xb5,0xaf,0xab},{0xa3,0x9c,0x98},{0xe8,0xe8,0xe1},{0xf0,0xf0,0xe8},
+{0xeb,0xeb,0xe4},{0xeb,0xeb,0xe4},{0xe1,0xe1,0xda},{0xec,0xec,0x82},
+{0xfc,0xfc,0x38},{0xfb,0xfb,0x46},{0xfa,0xfa,0x51},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfb,0xfb,0x46},
+{0xc7,0xc4,0xbf},{0x90,0x90,0x8c},{0xc8,0xc8,0xc2},{0xf0,0xf0,0xe8},
+{0xdf,0xdf,0xda},{0xe2,0xe2,0xdd},{0xe4,0xe4,0xd0},{0xed,0xec,0x50},
+{0xfc,0xfc,0x38},{0xf8,0xf8,0x59},{0xf6,0xf6,0x7a},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xc0,0xb6,0x7f},{0x92,0x8a,0x87},{0x9f,0x9a,0x96},{0xf0,0xf0,0xe8},
+{0xdf,0xdf,0xda},{0xdf,0xdf,0xda},{0xe4,0xe3,0xca},{0xf4,0xf3,0x44},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xcc,0xbd,0x4a},{0x8c,0x7b,0x79},{0x8a,0x8a,0x87},{0xf0,0xf0,0xe8},
+{0xdf,0xdf,0xda},{0xc8,0xc8,0xc8},{0xe6,0xe6,0xc6},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xc4,0xb4,0x57},{0x83,0x69,0x66},{0x8a,0x8a,0x87},{0xf0,0xf0,0xe8},
+{0xe4,0xe4,0xde},{0xcd,0xcd,0xcc},{0xe6,0xe6,0xd3},{0xf3,0xf2,0x59},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x36},
+{0x96,0x76,0x62},{0x73,0x6b,0x6a},{0x7d,0x7c,0x7b},{0xe5,0xe3,0xdc},
+{0xf0,0xf0,0xe8},{0xe7,0xe7,0xe0},{0xd3,0xd3,0xcf},{0xe2,0xe2,0xb2},
+{0xf7,0xf7,0x40},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},{0xfa,0xf9,0x37},{0xcc,0xbd,0x45},
+{0x82,0x69,0x66},{0x6d,0x6c,0x6c},{0x7f,0x6e,0x6c},{0xca,0xc3,0xbd},
+{0xf0,0xf0,0xe8},{0xde,0xde,0xd8},{0xb4,0xb4,0xb3},{0xcb,0xcb,0xc8},
+{0xdb,0xdb,0xa2},{0xf7,0xf7,0x40},{0xfc,0xfc,0x38},{0xfc,0xfc,0x38},
+{0xfc,0xfc,0x38},{0xfc,0xfc,0x37},{0xcc,0xbd,0x46},{0x8e,0x6b,0x63},
+{0x74,0x6b,0x6a},{0x71,0x6b,0x6b},{0x89,0x6a,0x67},{0xc7,0xbc,0xb5},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xd2,0xd2,0xce},{0xaa,0xa6,0xa5},
+{0xba,0xb6,0xb3},{0xd9,0xd8,0xc2},{0xcc,0xc3,0x7a},{0xcc,0xbd,0x47},
+{0xc4,0xb4,0x57},{0x96,0x76,0x62},{0x8a,0x68,0x64},{0x74,0x6b,0x6a},
+{0x6c,0x6c,0x6c},{0x7d,0x6a,0x68},{0x8c,0x68,0x64},{0xc5,0xb6,0xaf},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xef,0xef,0xe7},{0xe5,0xe4,0xdc},
+{0x9a,0x94,0x91},{0x8b,0x8b,0x88},{0x98,0x94,0x92},{0x86,0x71,0x6e},
+{0x83,0x69,0x66},{0x73,0x6b,0x6a},{0x70,0x6c,0x6b},{0x6c,0x6c,0x6c},
+{0x7d,0x6a,0x68},{0x8b,0x68,0x64},{0x8e,0x6e,0x6a},{0xcc,0xc6,0xc1},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xde,0xde,0xd8},{0xb3,0xb3,0xb0},{0xab,0xab,0xa8},{0x96,0x96,0x94},
+{0x8a,0x8a,0x87},{0x8a,0x84,0x81},{0x85,0x6f,0x6c},{0x83,0x69,0x66},
+{0x8c,0x68,0x64},{0x8e,0x6e,0x6a},{0xa5,0x91,0x8d},{0xe8,0xe8,0xe1},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},{0xf0,0xf0,0xe8},
+{0xf0,0xf0,0xe8},{0xe8,0xe8,0xe1},{0xcc,0xc6,0xc1},{0xc5,0xb6,0xaf},
+{0xc5,0xb6,0xaf},{0xcc,0xc6,0xc1},{0xe8,0xe8,0xe1},{0xf0,0xf0,0xe8}
+};
@@ -40,8 +40,14 @@
 /** @brief number of 32 bit words per glyph bitmap line */
 #define	BITMAPW	(256/32)
 
+/** @brief maximum number of pixels in a row for png_put_row() */
+#define	ROWMAX	2048
+
 int verbose;
 
+/** @brief row of pixels for png_get_row() and png_put_row() */
+static int row[ROWMAX];
+
 /** @brief structure of an Alto font */
 typedef struct {
 	/** @brief word: font height in scanlines */
@@ -61,24 +67,40 @@ typedef struct {
 static int png_write(void *cookie, uint8_t *buff, int size)
 {
 	FILE *fp = (FILE *)cookie;
-	if (size == fwrite(buff, 1, size, fp))
+	if (size != fwrite(buff, 1, size, fp))
 		return -1;
 	return 0;
 }
 
 static void png_bits(png_t *png, int x0, int y0, int pw, int ph, int w, int y, uint32_t *bitmap)
 {
-	int x, x1, y1;
-
-	for (x = 0; x < w; x++) {
-		if (bitmap[x/32] & (0x80000000 >> (x % 32))) {
-			for (y1 = y * ph; y1 < (y + 1) * ph; y1++)
-				for (x1 = x * pw; x1 < (x + 1) * pw; x1++)
-					png_put_pixel(png, x0 + x1, y0 + y1, 1, 0);
+	int x, x1, y1, n = w * pw;
+
+	if (n > ROWMAX)
+		n = ROWMAX;
+	for (y1 = y * ph; y1 < (y + 1) * ph; y1++) {
+		png_get_row(png, x0, y0 + y1, n, row, NULL);
+		for (x = 0; x < w; x++) {
+			if (bitmap[x/32] & (0x80000000 >> (x % 32))) {
+				for (x1 = x * pw; x1 < (x + 1) * pw && x1 < n; x1++)
+					row[x1] = 1;
+			}
 		}
+		png_put_row(png, x0, y0 + y1, n, row, NULL);
 	}
 }
 
+static void png_hline(png_t *png, int x0, int y0, int w, int color)
+{
+	int x;
+
+	if (w > ROWMAX)
+		w = ROWMAX;
+	for (x = 0; x < w; x++)
+		row[x] = color;
+	png_put_row(png, x0, y0, w, row, NULL);
+}
+
 #define	FONTW	6
 #define	FONTH	10
 #define	FONTC	2		/* color palette index to use for png_putch and png_printf */
@@ -219,10 +241,12 @@ static void png_putch(png_t *png, int x0, int y0, int n)
 	const uint8_t *src = &chargen[n * FONTH];
 
 	for (y = 0; y < FONTH; y++) {
+		png_get_row(png, x0, y0 + y, FONTW, row, NULL);
 		for (x = 0; x < FONTW; x++) {
 			if (src[y] & (0x80 >> x))
-				png_put_pixel(png, x0 + x, y0 + y, FONTC, 0);
+				row[x] = FONTC;
 		}
+		png_put_row(png, x0, y0 + y, FONTW, row, NULL);
 	}
 }
 
@@ -561,11 +585,9 @@ static int dump_font(char *filename, char *pngfile)
 		png->author = "Juergen Buchmueller <pullmoll@t-online.de>";
 
 		/* draw a border around the image */
-		for (x = 0; x < (pw * fw + aw) * rw; x++) {
-			png_put_pixel(png, x, 0, 3, 0);
-			png_put_pixel(png, x, 23, 3, 0);
-			png_put_pixel(png, x, 24 + (ph * fh + ah) * rh - 1, 3, 0);
-		}
+		png_hline(png, 0, 0, (pw * fw + aw) * rw, 3);
+		png_hline(png, 0, 23, (pw * fw + aw) * rw, 3);
+		png_hline(png, 0, 24 + (ph * fh + ah) * rh - 1, (pw * fw + aw) * rw, 3);
 
 		for (y = 0; y < 24 + (ph * fh + ah) * rh; y++) {
 			png_put_pixel(png, 0, y, 3, 0);
@@ -598,11 +620,9 @@ static int dump_font(char *filename, char *pngfile)
 
 			if (pw > 1) {
 				/* draw a grid for the character */
-				for (x = 0; x < pw * w; x++) {
-					for (y = 0; y <= ph * fh; y += ph) {
-						png_put_pixel(png, x0 + x, y0 + y,
-							y == ascent * ph ? 2 : 3, 0);
-					}
+				for (y = 0; y <= ph * fh; y += ph) {
+					png_hline(png, x0, y0 + y, pw * w,
+						y == ascent * ph ? 2 : 3);
 				}
 				for (y = 0; y < ph * fh; y++) {
 					for (x = 0; x <= pw * w; x += pw) {
@@ -611,10 +631,8 @@ static int dump_font(char *filename, char *pngfile)
 				}
 			} else {
 				/* draw a border for the character */
-				for (x = 0; x < pw * w; x++) {
-					png_put_pixel(png, x0 + x, y0 - 1, 1, 0);
-					png_put_pixel(png, x0 + x, y0 + ph*fh, 3, 0);
-				}
+				png_hline(png, x0, y0 - 1, pw * w, 1);
+				png_hline(png, x0, y0 + ph*fh, pw * w, 3);
 				for (y = 0; y < ph * fh; y++) {
 					png_put_pixel(png, x0 - 1, y0 + y, 1, 0);
 					png_put_pixel(png, x0 + pw*w, y0 + y, 3, 0);
@@ -0,0 +1,365 @@
+/*
+ * dovtool.c - create, list, commit and merge disk overlay (.dov) files
+ *
+ * An overlay holds the sectors written to a read-only base image,
+ * see include/dov.h for the file format.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "dov.h"
+#include "zcat.h"
+
+/** @brief number of pages of a Diablo 31 disk pack */
+#define	PAGES		4872
+
+/** @brief size of a sector in a .dsk image: page number, header, label, data */
+#define	SECTOR_SIZE	(2 * (1 + 2 + 8 + 256))
+
+typedef struct {
+	/** @brief path name of the overlay */
+	const char *path;
+
+	/** @brief file descriptor */
+	int fd;
+
+	/** @brief header */
+	dov_header_t hdr;
+
+	/** @brief page bitmap */
+	unsigned char bits[(PAGES + 7) / 8];
+}	dov_t;
+
+static unsigned char sector[SECTOR_SIZE];
+
+/* zcat.c reports allocation failures through fatal() */
+void fatal(int exitcode, const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	exit(exitcode);
+}
+
+#if	DEBUG
+/* zcat.c logs through logprintf() in DEBUG builds */
+int logprintf(int task, int level, const char *fmt, ...)
+{
+	return 0;
+}
+#endif
+
+int usage(int argc, char **argv)
+{
+	char *program = strrchr(argv[0], '/');
+	if (NULL == program)
+		program = argv[0];
+	else
+		program++;
+	fprintf(stderr, "usage: %s -n base.dsk[.Z] delta.dov\n", program);
+	fprintf(stderr, "       %s -l delta.dov\n", program);
+	fprintf(stderr, "       %s -c delta.dov [out.dsk]\n", program);
+	fprintf(stderr, "       %s -m into.dov from.dov\n", program);
+	fprintf(stderr, "-n   create an empty overlay for a base image\n");
+	fprintf(stderr, "-l   list the base image and the pages in an overlay\n");
+	fprintf(stderr, "-c   commit an overlay to its (uncompressed) base image and empty it,\n");
+	fprintf(stderr, "     or write the base image (.Z and .gz, too) with the overlay applied to out.dsk\n");
+	fprintf(stderr, "-m   merge the pages of from.dov into into.dov (same base image)\n");
+	return 0;
+}
+
+static void xpread(int fd, void *buff, size_t size, off_t offs, const char *path)
+{
+	if ((ssize_t)size != pread(fd, buff, size, offs)) {
+		fprintf(stderr, "%s: read error at %ld (%s)\n",
+			path, (long)offs, strerror(errno));
+		exit(1);
+	}
+}
+
+static void xpwrite(int fd, const void *buff, size_t size, off_t offs, const char *path)
+{
+	if ((ssize_t)size != pwrite(fd, buff, size, offs)) {
+		fprintf(stderr, "%s: write error at %ld (%s)\n",
+			path, (long)offs, strerror(errno));
+		exit(1);
+	}
+}
+
+static void xzread(zstream_t *zs, void *buff, size_t size, const char *path)
+{
+	size_t done = 0;
+	off_t got;
+
+	while (done < size) {
+		got = z_read(zs, (uint8_t *)buff + done, size - done);
+		if (got <= 0) {
+			fprintf(stderr, "%s: %s at %ld\n", path,
+				got < 0 ? "uncompress error" : "unexpected end", (long)done);
+			exit(1);
+		}
+		done += got;
+	}
+}
+
+static void xfsync(int fd, const char *path)
+{
+	if (fsync(fd) < 0) {
+		fprintf(stderr, "%s: fsync() failed (%s)\n", path, strerror(errno));
+		exit(1);
+	}
+}
+
+static void dov_open(dov_t *dov, const char *path, int mode)
+{
+	char journal[FILENAME_MAX];
+	struct stat st;
+
+	/* salto replays a journal left over by a crash when it loads the overlay */
+	snprintf(journal, sizeof(journal), "%s.journal", path);
+	if (0 == stat(journal, &st)) {
+		fprintf(stderr, "%s: journal %s pending; load the overlay in salto first\n",
+			path, journal);
+		exit(1);
+	}
+
+	dov->path = path;
+	dov->fd = open(path, mode);
+	if (dov->fd < 0) {
+		perror(path);
+		exit(1);
+	}
+	xpread(dov->fd, &dov->hdr, sizeof(dov->hdr), 0, path);
+	if (memcmp(dov->hdr.magic, DOV_MAGIC, sizeof(dov->hdr.magic)) ||
+		DOV_VERSION != dov->hdr.version ||
+		PAGES != dov->hdr.pages ||
+		SECTOR_SIZE != dov->hdr.sector_size) {
+		fprintf(stderr, "%s: not a valid overlay\n", path);
+		exit(1);
+	}
+	dov->hdr.base[sizeof(dov->hdr.base) - 1] = '\0';
+	xpread(dov->fd, dov->bits, sizeof(dov->bits), DOV_BITMAP, path);
+}
+
+static int dov_count(dov_t *dov)
+{
+	int page, count = 0;
+
+	for (page = 0; page < PAGES; page++)
+		count += DOV_TEST(dov->bits, page);
+	return count;
+}
+
+static int dov_create(const char *base, const char *path)
+{
+	dov_header_t hdr;
+	char *real;
+	int fd;
+
+	real = realpath(base, NULL);
+	if (!real) {
+		perror(base);
+		return 1;
+	}
+	if (strlen(real) >= sizeof(hdr.base)) {
+		fprintf(stderr, "%s: path name too long\n", real);
+		return 1;
+	}
+	fd = open(path, O_RDWR | O_CREAT | O_EXCL, 0644);
+	if (fd < 0) {
+		perror(path);
+		return 1;
+	}
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, DOV_MAGIC, sizeof(hdr.magic));
+	hdr.version = DOV_VERSION;
+	hdr.pages = PAGES;
+	hdr.sector_size = SECTOR_SIZE;
+	strcpy(hdr.base, real);
+	xpwrite(fd, &hdr, sizeof(hdr), 0, path);
+	if (ftruncate(fd, DOV_DATA_START) < 0) {
+		perror(path);
+		return 1;
+	}
+	xfsync(fd, path);
+	close(fd);
+	free(real);
+	return 0;
+}
+
+static int dov_list(const char *path)
+{
+	dov_t dov;
+	int page;
+
+	dov_open(&dov, path, O_RDONLY);
+	printf("base: %s\n", dov.hdr.base);
+	printf("pages: %d of %d\n", dov_count(&dov), PAGES);
+	for (page = 0; page < PAGES; page++) {
+		if (!DOV_TEST(dov.bits, page))
+			continue;
+		printf("page:%d cylinder:%d head:%d sector:%d\n",
+			page, page / 24, (page / 12) % 2, page % 12);
+	}
+	close(dov.fd);
+	return 0;
+}
+
+static int dov_commit(const char *path, const char *out)
+{
+	dov_t dov;
+	struct stat st;
+	const char *dst;
+	zstream_t *zs;
+	void *map;
+	int fd, src, page, count;
+
+	dov_open(&dov, path, out ? O_RDONLY : O_RDWR);
+	if (out) {
+		/* copy the base image to out first, uncompressing a .Z or .gz */
+		src = open(dov.hdr.base, O_RDONLY);
+		if (src < 0 || fstat(src, &st) < 0) {
+			perror(dov.hdr.base);
+			return 1;
+		}
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, src, 0);
+		if (MAP_FAILED == map) {
+			perror(dov.hdr.base);
+			return 1;
+		}
+		zs = z_open((uint8_t *)map, st.st_size);
+		if (!zs && st.st_size < (off_t)PAGES * SECTOR_SIZE) {
+			fprintf(stderr, "%s: not a disk image\n", dov.hdr.base);
+			return 1;
+		}
+		fd = open(out, O_RDWR | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0) {
+			perror(out);
+			return 1;
+		}
+		for (page = 0; page < PAGES; page++) {
+			if (zs)
+				xzread(zs, sector, SECTOR_SIZE, dov.hdr.base);
+			else
+				xpread(src, sector, SECTOR_SIZE, (off_t)page * SECTOR_SIZE, dov.hdr.base);
+			xpwrite(fd, sector, SECTOR_SIZE, (off_t)page * SECTOR_SIZE, out);
+		}
+		if (zs)
+			z_close(zs);
+		munmap(map, st.st_size);
+		close(src);
+		dst = out;
+	} else {
+		/* a compressed base can not be written in place */
+		if (0 == stat(dov.hdr.base, &st) && st.st_size < (off_t)PAGES * SECTOR_SIZE) {
+			fprintf(stderr, "%s: not an uncompressed disk image; commit to an out.dsk\n",
+				dov.hdr.base);
+			return 1;
+		}
+		fd = open(dov.hdr.base, O_RDWR);
+		if (fd < 0) {
+			perror(dov.hdr.base);
+			return 1;
+		}
+		dst = dov.hdr.base;
+	}
+	if (fstat(fd, &st) < 0 || st.st_size < (off_t)PAGES * SECTOR_SIZE) {
+		fprintf(stderr, "%s: not an uncompressed disk image\n", dst);
+		return 1;
+	}
+
+	count = 0;
+	for (page = 0; page < PAGES; page++) {
+		if (!DOV_TEST(dov.bits, page))
+			continue;
+		xpread(dov.fd, sector, SECTOR_SIZE, DOV_DATA(page, SECTOR_SIZE), path);
+		xpwrite(fd, sector, SECTOR_SIZE, (off_t)page * SECTOR_SIZE, dst);
+		count++;
+	}
+	xfsync(fd, dst);
+	close(fd);
+
+	if (!out) {
+		/* the base image has all changes now: empty the overlay */
+		memset(dov.bits, 0, sizeof(dov.bits));
+		xpwrite(dov.fd, dov.bits, sizeof(dov.bits), DOV_BITMAP, path);
+		if (ftruncate(dov.fd, DOV_DATA_START) < 0) {
+			perror(path);
+			return 1;
+		}
+		xfsync(dov.fd, path);
+	}
+	close(dov.fd);
+	printf("%s: committed %d pages to %s\n", path, count, dst);
+	return 0;
+}
+
+static int dov_merge(const char *into, const char *from)
+{
+	dov_t dst, src;
+	int page, count;
+
+	dov_open(&dst, into, O_RDWR);
+	dov_open(&src, from, O_RDONLY);
+	if (strcmp(dst.hdr.base, src.hdr.base)) {
+		fprintf(stderr, "%s and %s have different base images\n", into, from);
+		return 1;
+	}
+
+	/* write the sectors first, then the bitmap */
+	count = 0;
+	for (page = 0; page < PAGES; page++) {
+		if (!DOV_TEST(src.bits, page))
+			continue;
+		xpread(src.fd, sector, SECTOR_SIZE, DOV_DATA(page, SECTOR_SIZE), from);
+		xpwrite(dst.fd, sector, SECTOR_SIZE, DOV_DATA(page, SECTOR_SIZE), into);
+		DOV_MARK(dst.bits, page);
+		count++;
+	}
+	xfsync(dst.fd, into);
+	xpwrite(dst.fd, dst.bits, sizeof(dst.bits), DOV_BITMAP, into);
+	xfsync(dst.fd, into);
+	close(dst.fd);
+	close(src.fd);
+	printf("%s: merged %d pages from %s\n", into, count, from);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 3 || argv[1][0] != '-' || strlen(argv[1]) != 2) {
+		usage(argc, argv);
+		return 1;
+	}
+
+	switch (argv[1][1]) {
+	case 'n':
+		if (argc != 4)
+			break;
+		return dov_create(argv[2], argv[3]);
+	case 'l':
+		if (argc != 3)
+			break;
+		return dov_list(argv[2]);
+	case 'c':
+		if (argc != 3 && argc != 4)
+			break;
+		return dov_commit(argv[2], argc > 3 ? argv[3] : NULL);
+	case 'm':
+		if (argc != 4)
+			break;
+		return dov_merge(argv[2], argv[3]);
+	}
+	usage(argc, argv);
+	return 1;
+}